@@ -2,7 +2,7 @@
 // api.hpp
 // ~~~~~~~
 //
-// Copyright (C) 2023-2025 Artyom Kolpakov <ddvamp007@gmail.com>
+// Copyright (C) 2023-2026 Artyom Kolpakov <ddvamp007@gmail.com>
 //
 // Licensed under GNU GPL-3.0-or-later.
 // See file LICENSE or <https://www.gnu.org/licenses/> for details.
@@ -16,7 +16,13 @@
 #include <exe/fiber/core/fwd.hpp>
 #include <exe/fiber/core/handle.hpp>
 #include <exe/fiber/core/id.hpp>
+#include <exe/fiber/core/local.hpp>
+#include <exe/fiber/core/run_mark.hpp>
 #include <exe/fiber/core/scheduler.hpp>
+#include <exe/fiber/core/stack.hpp>
+
+#include <chrono>
+#include <cstddef>
 
 namespace exe::fiber {
 
@@ -34,6 +40,33 @@ void Go(Scheduler &where, Body &&body);
  */
 void Go(Body &&body);
 
+/**
+ *  Same as above, but with a stack of the given size class instead of
+ *  the default one (see SetDefaultStackSize)
+ */
+void Go(Scheduler &where, Body &&body, StackSize stack_size);
+void Go(Body &&body, StackSize stack_size);
+
+/**
+ *  Start fiber on where with the given priority. The priority is passed
+ *  to the scheduler each time the fiber is scheduled (see SetPriority)
+ */
+void Go(Scheduler &where, Body &&body, Priority priority);
+void Go(Scheduler &where, Body &&body, StackSize stack_size,
+        Priority priority);
+
+/**
+ *  Start count fibers on where, the i-th with body make_body(i).
+ *  Cheaper than Go in a loop: stacks are allocated in batches and fibers
+ *  are submitted as task chains. If make_body throws, the exception is
+ *  propagated, and the fibers created before are started anyway
+ *
+ *  Precondition: make_body == true && make_body returns non-empty bodies
+ */
+void GoMany(Scheduler &where, ::std::size_t count, BodyFactory make_body);
+void GoMany(Scheduler &where, ::std::size_t count, BodyFactory make_body,
+            StackSize stack_size);
+
 ////////////////////////////////////////////////////////////////////////////////
 
 /* Precondition: in fiber context */
@@ -44,12 +77,35 @@ namespace self {
 
 [[nodiscard]] Scheduler &GetScheduler() noexcept;
 
+[[nodiscard]] Priority GetPriority() noexcept;
+
+// Takes effect from the next rescheduling of current fiber
+void SetPriority(Priority priority) noexcept;
+
+// Slot of the current fiber, initially nullptr (see FiberLocal)
+[[nodiscard]] void *&GetLocal(FiberLocalKey key) noexcept;
+
 /* For synchronization primitives. Do not use directly */
 void Suspend(IAwaiter &) noexcept;
 
+/* For adaptive spinning in synchronization primitives */
+
+// Mark of the current run of current fiber
+[[nodiscard]] RunMark GetRunMark() noexcept;
+
+// Whether the marked run still goes on, and on another thread
+[[nodiscard]] bool IsRunningElsewhere(RunMark mark) noexcept;
+
 /* Reschedule current fiber */
 void Yield() noexcept;
 
+/**
+ *  Reschedule current fiber keeping it on the current worker of a thread
+ *  pool, so that its working set stays in cache. Only that worker runs it
+ *  again, even if others are idle. Elsewhere, the call is equivalent to yield
+ */
+void YieldLocal() noexcept;
+
 /**
  *  Reschedule current fiber and activate next one if it is valid
  *  otherwise, the call is equivalent to yield
@@ -59,6 +115,21 @@ void SwitchTo(FiberHandle &&next) noexcept;
 /* Reschedule current fiber on scheduler */
 void TeleportTo(Scheduler &scheduler) noexcept;
 
+/**
+ *  In handoff mode, the first fiber woken by a primitive (Event, WaitGroup,
+ *  Channel) on the same scheduler is not queued, but runs on this thread as
+ *  soon as current fiber suspends or completes, as with SwitchTo. Meant for
+ *  fibers that wake a peer right before blocking, e.g. in ping-pong
+ */
+void SetWakeHandoff(bool enable) noexcept;
+
+/**
+ *  Suspend current fiber without blocking the thread. The fiber is
+ *  rescheduled by a shared timer thread with millisecond precision
+ */
+void SleepFor(::std::chrono::steady_clock::duration duration) noexcept;
+void SleepUntil(::std::chrono::steady_clock::time_point deadline) noexcept;
+
 } // namespace self
 
 ////////////////////////////////////////////////////////////////////////////////
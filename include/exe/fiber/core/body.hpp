@@ -11,12 +11,16 @@
 #ifndef DDVAMP_EXE_FIBER_CORE_BODY_HPP_INCLUDED_
 #define DDVAMP_EXE_FIBER_CORE_BODY_HPP_INCLUDED_ 1
 
+#include <cstddef>
 #include <functional>
 
 namespace exe::fiber {
 
 using Body = ::std::move_only_function<void() && noexcept>;
 
+// Provides the body of the i-th fiber of a group (see GoMany)
+using BodyFactory = ::std::move_only_function<Body(::std::size_t)>;
+
 } // namespace exe::fiber
 
 #endif /* DDVAMP_EXE_FIBER_CORE_BODY_HPP_INCLUDED_ */
@@ -15,24 +15,39 @@
 #include <exe/fiber/core/body.hpp>
 #include <exe/fiber/core/coroutine.hpp>
 #include <exe/fiber/core/id.hpp>
+#include <exe/fiber/core/join_state.hpp>
+#include <exe/fiber/core/local.hpp>
 #include <exe/fiber/core/scheduler.hpp>
 #include <exe/fiber/core/stack.hpp>
 #include <exe/runtime/task/task.hpp>
 
+#include <util/memory/view.hpp>
+
 #include <atomic>
+#include <cstddef>
 #include <functional>
+#include <new>
+#include <utility>
 
 namespace exe::fiber {
 
 /* Fiber = stackful coroutine + scheduler */
 class [[nodiscard]] Fiber final : private runtime::task::TaskBase {
+  friend class JoinState;
+
  private:
   Stack stack_;
+  JoinState *const join_;
   Coroutine coroutine_;
   ::std::reference_wrapper<Scheduler> scheduler_;
   IAwaiter *awaiter_ = nullptr;
+  Fiber *successor_ = nullptr; // Woken in handoff mode, runs next
+  Priority priority_ = Priority::kNormal;
+  bool handoff_ = false;
   FiberId const id_ = GetNextId();
+  FiberLocalSlots locals_ = {};
 
+  // Start of the next unreserved block of ids
   inline static ::std::atomic<FiberId> next_id_ = kInvalidFiberId + 1;
 
   // To guarantee the expected implementation
@@ -41,6 +56,27 @@ class [[nodiscard]] Fiber final : private runtime::task::TaskBase {
  public:
   // Create an self-ownership fiber
   [[nodiscard]] static Fiber *Create(Body &&, Scheduler &);
+  [[nodiscard]] static Fiber *Create(Body &&, Scheduler &, StackSize);
+  [[nodiscard]] static Fiber *Create(Body &&, Scheduler &, StackSize,
+                                     Priority);
+
+  /**
+   *  Create count fibers with bodies from make_body and submit them to
+   *  scheduler as linked chains. Stacks are taken from the pool in batches.
+   *  If make_body throws, the fibers created before are still started
+   */
+  static void StartMany(Scheduler &scheduler, ::std::size_t count,
+                        BodyFactory &make_body, StackSize stack_size);
+
+  /**
+   *  Create a joinable fiber. State derived from JoinState is default
+   *  constructed in the stack allocation, right below the fiber, and
+   *  make_body(state) provides the body
+   */
+  template <typename State, typename MakeBody>
+  [[nodiscard]] static State &CreateJoinable(Scheduler &scheduler,
+                                             StackSize stack_size,
+                                             MakeBody make_body);
 
   // Reference to currently active fiber
   [[nodiscard]] static Fiber &Self() noexcept;
@@ -53,9 +89,33 @@ class [[nodiscard]] Fiber final : private runtime::task::TaskBase {
     return scheduler_.get();
   }
 
-  // Schedule execution on scheduler set on fiber
+  [[nodiscard]] Priority GetPriority() const noexcept {
+    return priority_;
+  }
+
+  // Takes effect from the next scheduling
+  void SetPriority(Priority const priority) noexcept {
+    priority_ = priority;
+  }
+
+  // Fibers woken by this one are run right after it suspends or completes
+  void SetWakeHandoff(bool const enable) noexcept {
+    handoff_ = enable;
+  }
+
+  [[nodiscard]] void *&GetLocal(FiberLocalKey const key) noexcept {
+    return locals_[key];
+  }
+
+  // Schedule execution on scheduler set on fiber, with fiber's priority
   void Schedule() noexcept;
 
+  // Schedule, preferring the current worker thread of the scheduler
+  void ScheduleLocal() noexcept;
+
+  // Schedule, or become the successor of the current fiber in handoff mode
+  void Wake() noexcept;
+
   // Execute fiber immediately
   void Resume() noexcept;
 
@@ -65,7 +125,15 @@ class [[nodiscard]] Fiber final : private runtime::task::TaskBase {
   void TeleportTo(Scheduler &) noexcept;
 
  private:
-  Fiber(Body &&, Stack &&, Scheduler &) noexcept;
+  // Coroutine runs on the part of the stack allocation below stack_top
+  Fiber(Body &&, Stack &&, Scheduler &, void *stack_top,
+        JoinState *join = nullptr) noexcept;
+
+  // Fiber is placed at the top of its stack allocation
+  [[nodiscard]] static void *PlaceControlBlock(Stack &) noexcept;
+  [[nodiscard]] static void *PlaceBelow(void *place, ::std::size_t size,
+                                        ::std::size_t align) noexcept;
+  [[nodiscard]] ::util::memory_view ExecutionStack(void *top) noexcept;
 
   // TaskBase
   void Run() && noexcept override;
@@ -73,12 +141,33 @@ class [[nodiscard]] Fiber final : private runtime::task::TaskBase {
 
   [[nodiscard]] IAwaiter *Step() noexcept;
   void Stop() noexcept;
+  [[nodiscard]] Fiber *Complete() noexcept;
   void DestroySelf() noexcept;
-  void ReleaseResources() noexcept;
 
   [[nodiscard]] static FiberId GetNextId() noexcept;
 };
 
+template <typename State, typename MakeBody>
+/* static */ State &Fiber::CreateJoinable(Scheduler &scheduler,
+                                          StackSize const stack_size,
+                                          MakeBody make_body) {
+  auto stack = AllocateStack(stack_size);
+  auto const place = PlaceControlBlock(stack);
+  auto const state_place = PlaceBelow(place, sizeof(State), alignof(State));
+  auto &state = *::new (state_place) State();
+
+  try {
+    ::new (place) Fiber(make_body(state), ::std::move(stack), scheduler,
+                        state_place, &state);
+  } catch (...) {
+    state.~State();
+    DeallocateStack(::std::move(stack));
+    throw;
+  }
+
+  return state;
+}
+
 } // namespace exe::fiber
 
 #endif /* DDVAMP_EXE_FIBER_CORE_FIBER_HPP_INCLUDED_ */
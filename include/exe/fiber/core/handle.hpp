@@ -2,7 +2,7 @@
 // handle.hpp
 // ~~~~~~~~~~
 //
-// Copyright (C) 2023-2025 Artyom Kolpakov <ddvamp007@gmail.com>
+// Copyright (C) 2023-2026 Artyom Kolpakov <ddvamp007@gmail.com>
 //
 // Licensed under GNU GPL-3.0-or-later.
 // See file LICENSE or <https://www.gnu.org/licenses/> for details.
@@ -18,6 +18,7 @@ namespace exe::fiber {
 /* Class for managing fiber in awaiters */
 class [[nodiscard]] FiberHandle {
   friend class Fiber;
+  friend class JoinState;
 
  private:
   Fiber *fiber_ = nullptr;
@@ -52,6 +53,19 @@ class [[nodiscard]] FiberHandle {
   // Synonym for Schedule
   void Resume() && noexcept;
 
+  // Same as Schedule, but the fiber may stay on the current worker
+  // thread (see IScheduler::SubmitLocal)
+  //
+  // Precondition: IsValid() == true
+  void ScheduleLocal() && noexcept;
+
+  // Same as Schedule, but if the current fiber is in handoff mode
+  // (see self::SetWakeHandoff), the fiber may run right after the current
+  // one suspends, bypassing the scheduler queue. For waking in primitives
+  //
+  // Precondition: IsValid() == true
+  void Wake() && noexcept;
+
  private:
   explicit FiberHandle(Fiber &fiber) noexcept : fiber_(&fiber) {}
 
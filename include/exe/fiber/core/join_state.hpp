@@ -0,0 +1,82 @@
+//
+// join_state.hpp
+// ~~~~~~~~~~~~~~
+//
+// Copyright (C) 2026 Artyom Kolpakov <ddvamp007@gmail.com>
+//
+// Licensed under GNU GPL-3.0-or-later.
+// See file LICENSE or <https://www.gnu.org/licenses/> for details.
+//
+
+#ifndef DDVAMP_EXE_FIBER_CORE_JOIN_STATE_HPP_INCLUDED_
+#define DDVAMP_EXE_FIBER_CORE_JOIN_STATE_HPP_INCLUDED_ 1
+
+#include <exe/fiber/core/fwd.hpp>
+
+#include <atomic>
+#include <cstdint>
+
+namespace exe::fiber {
+
+/**
+ *  Completion state of a joinable fiber, placed in the stack allocation of
+ *  that fiber. The fiber and its stack are kept after the completion until
+ *  the result is taken (Wait + Destroy) or the fiber is detached
+ */
+class JoinState {
+  friend class Fiber;
+
+ private:
+  class Awaiter;
+
+  // Otherwise, the state holds the waiting fiber
+  inline static constexpr ::std::uintptr_t kRunning = 0;
+  inline static constexpr ::std::uintptr_t kCompleted = 1;
+  inline static constexpr ::std::uintptr_t kDetached = 2;
+
+  ::std::atomic_uintptr_t state_ = kRunning;
+  Fiber *fiber_ = nullptr;
+
+  // To guarantee the expected implementation
+  static_assert(::std::atomic_uintptr_t::is_always_lock_free);
+
+ protected:
+  // Destroyed together with the fiber
+  virtual ~JoinState() = default;
+
+ public:
+  JoinState(JoinState const &) = delete;
+  void operator= (JoinState const &) = delete;
+
+  JoinState(JoinState &&) = delete;
+  void operator= (JoinState &&) = delete;
+
+ public:
+  JoinState() noexcept = default;
+
+  [[nodiscard]] Fiber &GetFiber() const noexcept {
+    return *fiber_;
+  }
+
+  /**
+   *  Suspends the current fiber until the joinable fiber completes.
+   *  At most one waiter
+   *
+   *  Precondition: in fiber context
+   */
+  void Wait() noexcept;
+
+  // Destroys the completed fiber with this state
+  void Destroy() noexcept;
+
+  // The fiber destroys itself when completes
+  void Detach() noexcept;
+
+ private:
+  // Returns the waiting fiber, if any
+  [[nodiscard]] Fiber *Complete() noexcept;
+};
+
+} // namespace exe::fiber
+
+#endif /* DDVAMP_EXE_FIBER_CORE_JOIN_STATE_HPP_INCLUDED_ */
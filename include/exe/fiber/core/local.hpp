@@ -0,0 +1,42 @@
+//
+// local.hpp
+// ~~~~~~~~~
+//
+// Copyright (C) 2026 Artyom Kolpakov <ddvamp007@gmail.com>
+//
+// Licensed under GNU GPL-3.0-or-later.
+// See file LICENSE or <https://www.gnu.org/licenses/> for details.
+//
+
+#ifndef DDVAMP_EXE_FIBER_CORE_LOCAL_HPP_INCLUDED_
+#define DDVAMP_EXE_FIBER_CORE_LOCAL_HPP_INCLUDED_ 1
+
+#include <array>
+#include <cstddef>
+
+namespace exe::fiber {
+
+// Number of fiber-local slots in each fiber
+inline constexpr ::std::size_t kMaxFiberLocals = 16;
+
+using FiberLocalKey = ::std::size_t;
+
+// Called for non-null values when a fiber completes, not in fiber context
+using FiberLocalDestructor = void (*)(void *) noexcept;
+
+using FiberLocalSlots = ::std::array<void *, kMaxFiberLocals>;
+
+/**
+ *  Reserves a slot in all fibers. Keys are never released
+ *
+ *  Throws: std::length_error if all slots are reserved
+ */
+[[nodiscard]] FiberLocalKey CreateFiberLocalKey(
+    FiberLocalDestructor destructor);
+
+/* For Fiber. Do not use directly */
+void DestroyFiberLocals(FiberLocalSlots &slots) noexcept;
+
+} // namespace exe::fiber
+
+#endif /* DDVAMP_EXE_FIBER_CORE_LOCAL_HPP_INCLUDED_ */
@@ -0,0 +1,31 @@
+//
+// run_mark.hpp
+// ~~~~~~~~~~~~
+//
+// Copyright (C) 2026 Artyom Kolpakov <ddvamp007@gmail.com>
+//
+// Licensed under GNU GPL-3.0-or-later.
+// See file LICENSE or <https://www.gnu.org/licenses/> for details.
+//
+
+#ifndef DDVAMP_EXE_FIBER_CORE_RUN_MARK_HPP_INCLUDED_
+#define DDVAMP_EXE_FIBER_CORE_RUN_MARK_HPP_INCLUDED_ 1
+
+#include <atomic>
+#include <cstdint>
+
+namespace exe::fiber {
+
+/**
+ *  Identifies a run of a fiber on a thread: each thread counts fibers
+ *  that stopped running on it, so the mark becomes stale as soon as
+ *  the fiber suspends or completes (see self::GetRunMark)
+ */
+struct RunMark {
+  ::std::atomic_uint64_t const *switches = nullptr;
+  ::std::uint64_t epoch = 0;
+};
+
+} // namespace exe::fiber
+
+#endif /* DDVAMP_EXE_FIBER_CORE_RUN_MARK_HPP_INCLUDED_ */
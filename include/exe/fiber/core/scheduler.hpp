@@ -11,12 +11,15 @@
 #ifndef DDVAMP_EXE_FIBER_CORE_SCHEDULER_HPP_INCLUDED_
 #define DDVAMP_EXE_FIBER_CORE_SCHEDULER_HPP_INCLUDED_ 1
 
+#include <exe/runtime/task/priority.hpp>
 #include <exe/runtime/task/scheduler.hpp>
 
 namespace exe::fiber {
 
 using Scheduler = runtime::task::ISafeScheduler;
 
+using Priority = runtime::task::Priority;
+
 } // namespace exe::fiber
 
 #endif /* DDVAMP_EXE_FIBER_CORE_SCHEDULER_HPP_INCLUDED_ */
@@ -2,7 +2,7 @@
 // stack.hpp
 // ~~~~~~~~~
 //
-// Copyright (C) 2023-2025 Artyom Kolpakov <ddvamp007@gmail.com>
+// Copyright (C) 2023-2026 Artyom Kolpakov <ddvamp007@gmail.com>
 //
 // Licensed under GNU GPL-3.0-or-later.
 // See file LICENSE or <https://www.gnu.org/licenses/> for details.
@@ -13,14 +13,76 @@
 
 #include <context/stack.hpp>
 
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+
 namespace exe::fiber {
 
 using Stack = ::context::Stack;
 
+// Size classes of fiber stacks, each class has its own pool
+enum class StackSize : ::std::uint8_t {
+  k16K,
+  k64K,
+  k256K,
+  k1M,
+};
+
+inline constexpr ::std::size_t kStackSizeClasses = 4;
+
+[[nodiscard]] inline constexpr ::std::size_t StackBytes(StackSize const size)
+    noexcept {
+  return ::std::size_t{16 * 1024} << (2 * static_cast<unsigned>(size));
+}
+
+// Class used when it is not specified, initially k1M
+[[nodiscard]] StackSize GetDefaultStackSize() noexcept;
+void SetDefaultStackSize(StackSize size) noexcept;
+
+Stack AllocateStack(StackSize size);
+
 Stack AllocateStack();
 
+// Fills out with stacks of the given class, taking them from the pool
+// in one step. On exception, out is left unchanged
+void AllocateStacks(StackSize size, ::std::span<Stack> out);
+
 void DeallocateStack(Stack &&stack) noexcept;
 
+/* Stack usage profiling */
+
+// Used bytes of stacks of a size class, histogram bucket i counts
+// stacks that used at most BucketLimit(i) bytes
+struct StackUsage {
+  inline static constexpr ::std::size_t kBuckets = 9; // 4K .. 1M
+
+  [[nodiscard]] static constexpr ::std::size_t BucketLimit(
+      ::std::size_t const idx) noexcept {
+    return ::std::size_t{4 * 1024} << idx;
+  }
+
+  ::std::uint64_t samples;
+  ::std::size_t max_bytes;
+  ::std::array<::std::uint64_t, kBuckets> histogram;
+};
+
+/**
+ *  Stacks are painted with a pattern, and the used part is measured
+ *  when fibers complete. Must be called before any fiber is created.
+ *  Disables releasing memory of pooled stacks
+ */
+void EnableStackProfiling() noexcept;
+
+[[nodiscard]] bool IsStackProfilingEnabled() noexcept;
+
+// Measures the used part of a stack of a completed fiber and repaints it
+void RecordStackUsage(Stack &stack) noexcept;
+
+// Values may be stale
+[[nodiscard]] StackUsage GetStackUsage(StackSize size) noexcept;
+
 } // namespace exe::fiber
 
 #endif /* DDVAMP_EXE_FIBER_CORE_STACK_HPP_INCLUDED_ */
@@ -0,0 +1,48 @@
+//
+// file.hpp
+// ~~~~~~~~
+//
+// Copyright (C) 2026 Artyom Kolpakov <ddvamp007@gmail.com>
+//
+// Licensed under GNU GPL-3.0-or-later.
+// See file LICENSE or <https://www.gnu.org/licenses/> for details.
+//
+
+#ifndef DDVAMP_EXE_FIBER_FS_FILE_HPP_INCLUDED_
+#define DDVAMP_EXE_FIBER_FS_FILE_HPP_INCLUDED_ 1
+
+#include <exe/result/result.hpp>
+
+#include <sys/types.h> // off_t
+
+#include <cstddef>
+#include <span>
+#include <system_error>
+
+namespace exe::fiber::fs {
+
+/**
+ *  Regular files are always "ready" for epoll, so these calls are executed
+ *  on a small dedicated I/O thread pool. The current fiber is suspended
+ *  meanwhile and then resumed on its own scheduler, so blocking disk I/O
+ *  does not stall the workers of that scheduler
+ *
+ *  Precondition: in fiber context
+ */
+
+// Reads up to buf.size() bytes at offset, returns 0 at the end of file
+[[nodiscard]] Result<::std::size_t, ::std::error_code> Read(
+    int fd, ::std::span<::std::byte> buf, ::off_t offset) noexcept;
+
+// Writes the whole buf at offset, unless an error occurs. If some bytes
+// are written before the error, their number is returned, and the error
+// is reported by the next call that writes the rest
+[[nodiscard]] Result<::std::size_t, ::std::error_code> Write(
+    int fd, ::std::span<::std::byte const> buf, ::off_t offset) noexcept;
+
+// fsync, or fdatasync if data_only
+[[nodiscard]] ::std::error_code Fsync(int fd, bool data_only = false) noexcept;
+
+} // namespace exe::fiber::fs
+
+#endif /* DDVAMP_EXE_FIBER_FS_FILE_HPP_INCLUDED_ */
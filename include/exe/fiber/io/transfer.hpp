@@ -0,0 +1,96 @@
+//
+// transfer.hpp
+// ~~~~~~~~~~~~
+//
+// Copyright (C) 2026 Artyom Kolpakov <ddvamp007@gmail.com>
+//
+// Licensed under GNU GPL-3.0-or-later.
+// See file LICENSE or <https://www.gnu.org/licenses/> for details.
+//
+
+#ifndef DDVAMP_EXE_FIBER_IO_TRANSFER_HPP_INCLUDED_
+#define DDVAMP_EXE_FIBER_IO_TRANSFER_HPP_INCLUDED_ 1
+
+#include <exe/runtime/reactor.hpp>
+
+#include <sys/types.h> // off_t
+
+#include <cstddef>
+#include <system_error>
+
+namespace exe::fiber::io {
+
+/**
+ *  Zero-copy transfers that keep data in the kernel. Sockets must be
+ *  in non-blocking mode. When a socket is not ready, the current fiber is
+ *  suspended until the reactor reports readiness (see io::Wait)
+ */
+
+struct [[nodiscard]] TransferResult {
+  // Bytes transferred before the end of input or the error
+  ::std::size_t bytes = 0;
+  ::std::error_code error;
+};
+
+/* Pipe for Splice, can be reused between transfers */
+class SplicePipe {
+ private:
+  int read_fd_ = -1;
+  int write_fd_ = -1;
+
+ public:
+  ~SplicePipe();
+
+  SplicePipe(SplicePipe const &) = delete;
+  void operator= (SplicePipe const &) = delete;
+
+  SplicePipe(SplicePipe &&) = delete;
+  void operator= (SplicePipe &&) = delete;
+
+ public:
+  // Opened lazily on first use
+  SplicePipe() noexcept = default;
+
+  [[nodiscard]] ::std::error_code Open() noexcept;
+
+  [[nodiscard]] bool IsOpen() const noexcept {
+    return read_fd_ != -1;
+  }
+
+  // Also discards data left in pipe after a failed transfer
+  void Close() noexcept;
+
+  [[nodiscard]] int ReadEnd() const noexcept {
+    return read_fd_;
+  }
+
+  [[nodiscard]] int WriteEnd() const noexcept {
+    return write_fd_;
+  }
+};
+
+/**
+ *  Sends count bytes of file in_fd starting at offset to socket out_fd
+ *  using sendfile(2). Stops early at the end of the file
+ *
+ *  Precondition: in fiber context
+ */
+TransferResult SendFile(runtime::Reactor &reactor, int out_fd, int in_fd,
+                        ::off_t offset, ::std::size_t count) noexcept;
+
+/**
+ *  Moves count bytes from in_fd to out_fd through pipe using splice(2).
+ *  Stops early at the end of input
+ *
+ *  Precondition: in fiber context
+ */
+TransferResult Splice(runtime::Reactor &reactor, int in_fd, int out_fd,
+                      ::std::size_t count, SplicePipe &pipe) noexcept;
+
+// Same as above, but with a temporary pipe
+TransferResult Splice(runtime::Reactor &reactor, int in_fd, int out_fd,
+                      ::std::size_t count) noexcept;
+
+} // namespace exe::fiber::io
+
+#endif /* DDVAMP_EXE_FIBER_IO_TRANSFER_HPP_INCLUDED_ */
@@ -0,0 +1,115 @@
+//
+// wait.hpp
+// ~~~~~~~~
+//
+// Copyright (C) 2026 Artyom Kolpakov <ddvamp007@gmail.com>
+//
+// Licensed under GNU GPL-3.0-or-later.
+// See file LICENSE or <https://www.gnu.org/licenses/> for details.
+//
+
+#ifndef DDVAMP_EXE_FIBER_IO_WAIT_HPP_INCLUDED_
+#define DDVAMP_EXE_FIBER_IO_WAIT_HPP_INCLUDED_ 1
+
+#include <exe/fiber/api.hpp>
+#include <exe/fiber/core/awaiter.hpp>
+#include <exe/fiber/core/handle.hpp>
+#include <exe/result/result.hpp>
+#include <exe/runtime/reactor.hpp>
+
+#include <sys/epoll.h>
+
+#include <cstdint>
+#include <system_error>
+#include <utility>
+
+namespace exe::fiber::io {
+
+namespace detail {
+
+class WaitAwaiter final : public IAwaiter, private runtime::Operation {
+ private:
+  runtime::Reactor &reactor_;
+  int const fd_;
+  ::std::uint32_t const events_;
+  FiberHandle handle_;
+  ::std::uint32_t ready_ = 0;
+  ::std::error_code error_;
+
+ public:
+  WaitAwaiter(runtime::Reactor &reactor, int fd,
+              ::std::uint32_t events) noexcept
+      : reactor_(reactor)
+      , fd_(fd)
+      , events_(events) {}
+
+  [[nodiscard]] Result<::std::uint32_t, ::std::error_code> GetResult()
+      const noexcept {
+    if (error_) [[unlikely]] {
+      return result::Err<::std::uint32_t>(error_);
+    }
+    return result::Ok<::std::uint32_t, ::std::error_code>(ready_);
+  }
+
+  FiberHandle AwaitSymmetricSuspend(FiberHandle &&self) noexcept override {
+    handle_ = ::std::move(self);
+
+    // The fd is left registered in a disarmed state after the event,
+    // so the next wait on it only needs to rearm the registration
+    auto const events = events_ | EPOLLONESHOT;
+    auto ec = reactor_.ModFd(fd_, events, *this);
+    if (ec == ::std::errc::no_such_file_or_directory) [[unlikely]] {
+      ec = reactor_.AddFd(fd_, events, *this);
+    }
+
+    if (ec) [[unlikely]] {
+      error_ = ec;
+      return ::std::move(handle_);
+    }
+
+    // From now on, the awaiter may be destroyed at any time
+    return FiberHandle::Invalid();
+  }
+
+ private:
+  // runtime::Operation
+  void OnEvent(::std::uint32_t const events) noexcept override {
+    ready_ = events;
+    ::std::move(handle_).Schedule();
+  }
+};
+
+} // namespace detail
+
+/**
+ *  Suspends the current fiber until fd is ready for any of events
+ *  (EPOLLIN, EPOLLOUT, ...) and returns the ready events.
+ *  The fd stays registered in reactor with EPOLLONESHOT until it is closed
+ *  or removed with Reactor::DelFd. It must not be registered in reactor in
+ *  any other way. Concurrent waits on the same fd are not allowed
+ *
+ *  Precondition: in fiber context
+ */
+[[nodiscard]] inline Result<::std::uint32_t, ::std::error_code> Wait(
+    runtime::Reactor &reactor, int const fd,
+    ::std::uint32_t const events) noexcept {
+  detail::WaitAwaiter awaiter(reactor, fd, events);
+  self::Suspend(awaiter);
+  return awaiter.GetResult();
+}
+
+[[nodiscard]] inline ::std::error_code WaitReadable(runtime::Reactor &reactor,
+                                                   int const fd) noexcept {
+  auto const res = Wait(reactor, fd, EPOLLIN | EPOLLRDHUP);
+  return res ? ::std::error_code() : res.error();
+}
+
+[[nodiscard]] inline ::std::error_code WaitWritable(runtime::Reactor &reactor,
+                                                   int const fd) noexcept {
+  auto const res = Wait(reactor, fd, EPOLLOUT);
+  return res ? ::std::error_code() : res.error();
+}
+
+} // namespace exe::fiber::io
+
+#endif /* DDVAMP_EXE_FIBER_IO_WAIT_HPP_INCLUDED_ */
@@ -0,0 +1,155 @@
+//
+// join.hpp
+// ~~~~~~~~
+//
+// Copyright (C) 2026 Artyom Kolpakov <ddvamp007@gmail.com>
+//
+// Licensed under GNU GPL-3.0-or-later.
+// See file LICENSE or <https://www.gnu.org/licenses/> for details.
+//
+
+#ifndef DDVAMP_EXE_FIBER_JOIN_HPP_INCLUDED_
+#define DDVAMP_EXE_FIBER_JOIN_HPP_INCLUDED_ 1
+
+#include <exe/fiber/api.hpp>
+#include <exe/fiber/core/fiber.hpp>
+#include <exe/fiber/core/join_state.hpp>
+
+#include <util/debug/assert.hpp>
+
+#include <functional>
+#include <optional>
+#include <type_traits>
+#include <utility>
+#include <variant> // monostate
+
+namespace exe::fiber {
+
+namespace detail {
+
+template <typename T>
+class JoinResult final : public JoinState {
+ public:
+  using Value = ::std::conditional_t<::std::is_void_v<T>, ::std::monostate, T>;
+
+  ::std::optional<Value> value;
+};
+
+} // namespace detail
+
+/**
+ *  Owner of a fiber started by Spawn. The result lives in the stack
+ *  allocation of the fiber, so spawning and joining need no allocations
+ *  besides the pooled stack. The handle detaches the fiber if it is
+ *  destroyed without Join
+ */
+template <typename T>
+class [[nodiscard]] JoinHandle {
+ private:
+  using State = detail::JoinResult<T>;
+
+  State *state_ = nullptr;
+
+ public:
+  ~JoinHandle() {
+    if (IsValid()) {
+      Detach();
+    }
+  }
+
+  JoinHandle(JoinHandle const &) = delete;
+  void operator= (JoinHandle const &) = delete;
+
+  JoinHandle(JoinHandle &&that) noexcept
+      : state_(::std::exchange(that.state_, nullptr)) {}
+
+  // Detaches the previous fiber, if any
+  JoinHandle &operator= (JoinHandle &&that) noexcept {
+    JoinHandle old(::std::move(that));
+    ::std::swap(state_, old.state_);
+    return *this;
+  }
+
+ public:
+  JoinHandle() noexcept = default;
+
+  explicit JoinHandle(State &state) noexcept : state_(&state) {}
+
+  [[nodiscard]] bool IsValid() const noexcept {
+    return state_;
+  }
+
+  /**
+   *  Waits for the fiber to complete and returns its result. The awaiting
+   *  fiber is resumed directly by the completing one
+   *
+   *  Precondition: IsValid() && in fiber context
+   */
+  T Join() noexcept (::std::is_void_v<T> ||
+                     ::std::is_nothrow_move_constructible_v<T>) {
+    UTIL_ASSERT(IsValid(), "Joining an empty JoinHandle");
+    auto const state = ::std::exchange(state_, nullptr);
+    state->Wait();
+
+    if constexpr (::std::is_void_v<T>) {
+      state->Destroy();
+    } else {
+      T value = ::std::move(*state->value);
+      state->Destroy();
+      return value;
+    }
+  }
+
+  // Precondition: IsValid()
+  void Detach() noexcept {
+    UTIL_ASSERT(IsValid(), "Detaching an empty JoinHandle");
+    ::std::exchange(state_, nullptr)->Detach();
+  }
+};
+
+/**
+ *  Start fiber on where and return its handle
+ *
+ *  Precondition: fn is nothrow invocable
+ */
+template <typename Fn>
+  requires (::std::is_nothrow_invocable_v<Fn>)
+[[nodiscard]] auto Spawn(Scheduler &where, Fn fn,
+                         StackSize const stack_size = GetDefaultStackSize())
+    -> JoinHandle<::std::invoke_result_t<Fn>> {
+  using T = ::std::invoke_result_t<Fn>;
+  using State = detail::JoinResult<T>;
+
+  auto &state = Fiber::CreateJoinable<State>(
+      where, stack_size, [&fn](State &state) {
+        return Body([&state, fn = ::std::move(fn)]() mutable noexcept {
+          if constexpr (::std::is_void_v<T>) {
+            ::std::invoke(fn);
+            state.value.emplace();
+          } else {
+            state.value.emplace(::std::invoke(fn));
+          }
+        });
+      });
+
+  JoinHandle<T> handle(state);
+  state.GetFiber().Schedule();
+  return handle;
+}
+
+/**
+ *  Start fiber on scheduler of current fiber and return its handle
+ *
+ *  Precondition: in fiber context
+ */
+template <typename Fn>
+  requires (::std::is_nothrow_invocable_v<Fn>)
+[[nodiscard]] auto Spawn(Fn fn,
+                         StackSize const stack_size = GetDefaultStackSize())
+    -> JoinHandle<::std::invoke_result_t<Fn>> {
+  return Spawn(self::GetScheduler(), ::std::move(fn), stack_size);
+}
+
+} // namespace exe::fiber
+
+#endif /* DDVAMP_EXE_FIBER_JOIN_HPP_INCLUDED_ */
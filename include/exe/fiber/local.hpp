@@ -0,0 +1,83 @@
+//
+// local.hpp
+// ~~~~~~~~~
+//
+// Copyright (C) 2026 Artyom Kolpakov <ddvamp007@gmail.com>
+//
+// Licensed under GNU GPL-3.0-or-later.
+// See file LICENSE or <https://www.gnu.org/licenses/> for details.
+//
+
+#ifndef DDVAMP_EXE_FIBER_LOCAL_HPP_INCLUDED_
+#define DDVAMP_EXE_FIBER_LOCAL_HPP_INCLUDED_ 1
+
+#include <exe/fiber/api.hpp>
+#include <exe/fiber/core/local.hpp>
+
+#include <type_traits>
+#include <utility>
+
+namespace exe::fiber {
+
+/**
+ *  Analogue of thread_local for fibers. Each fiber has its own value,
+ *  which is destroyed when the fiber completes. Keys are a limited
+ *  resource (kMaxFiberLocals), so FiberLocal is meant to be static
+ *
+ *  Precondition for member functions: in fiber context
+ */
+template <typename T>
+  requires (::std::is_nothrow_destructible_v<T>)
+class FiberLocal {
+ private:
+  FiberLocalKey const key_;
+
+ public:
+  ~FiberLocal() = default;
+
+  FiberLocal(FiberLocal const &) = delete;
+  void operator= (FiberLocal const &) = delete;
+
+  FiberLocal(FiberLocal &&) = delete;
+  void operator= (FiberLocal &&) = delete;
+
+ public:
+  // Throws: std::length_error if all keys are reserved
+  FiberLocal()
+      : key_(CreateFiberLocalKey(&Destroy)) {}
+
+  // Value of the current fiber, default-constructed on the first access
+  [[nodiscard]] T &Get() {
+    auto &slot = self::GetLocal(key_);
+    if (!slot) [[unlikely]] {
+      slot = new T();
+    }
+    return *static_cast<T *>(slot);
+  }
+
+  // nullptr if the current fiber has no value
+  [[nodiscard]] T *TryGet() const noexcept {
+    return static_cast<T *>(self::GetLocal(key_));
+  }
+
+  template <typename... Args>
+  T &Emplace(Args &&...args) {
+    auto const value = new T(::std::forward<Args>(args)...);
+    Reset();
+    self::GetLocal(key_) = value;
+    return *value;
+  }
+
+  void Reset() noexcept {
+    Destroy(::std::exchange(self::GetLocal(key_), nullptr));
+  }
+
+ private:
+  static void Destroy(void *const value) noexcept {
+    delete static_cast<T *>(value);
+  }
+};
+
+} // namespace exe::fiber
+
+#endif /* DDVAMP_EXE_FIBER_LOCAL_HPP_INCLUDED_ */
@@ -2,7 +2,7 @@
 // channel.hpp
 // ~~~~~~~~~~~
 //
-// Copyright (C) 2023-2025 Artyom Kolpakov <ddvamp007@gmail.com>
+// Copyright (C) 2023-2026 Artyom Kolpakov <ddvamp007@gmail.com>
 //
 // Licensed under GNU GPL-3.0-or-later.
 // See file LICENSE or <https://www.gnu.org/licenses/> for details.
@@ -200,7 +200,7 @@ class ChannelState {
    private:
     void Schedule(bool is_sent) noexcept {
       is_sent_ = is_sent;
-      ::std::move(handle_).Schedule();
+      ::std::move(handle_).Wake();
     }
   };
 
@@ -225,7 +225,7 @@ class ChannelState {
 
    private:
     void Schedule() noexcept {
-      ::std::move(handle_).Schedule();
+      ::std::move(handle_).Wake();
     }
   };
 
@@ -2,7 +2,7 @@
 // condvar.hpp
 // ~~~~~~~~~~~
 //
-// Copyright (C) 2023-2025 Artyom Kolpakov <ddvamp007@gmail.com>
+// Copyright (C) 2023-2026 Artyom Kolpakov <ddvamp007@gmail.com>
 //
 // Licensed under GNU GPL-3.0-or-later.
 // See file LICENSE or <https://www.gnu.org/licenses/> for details.
@@ -57,6 +57,9 @@ class Condvar {
   void Wait() noexcept {
     Waiter awaiter(*this);
     self::Suspend(awaiter);
+
+    // The mutex was handed over while the fiber was suspended
+    m_.MarkOwner();
   }
 
   template <typename Predicate>
@@ -2,7 +2,7 @@
 // event.hpp
 // ~~~~~~~~~
 //
-// Copyright (C) 2023-2025 Artyom Kolpakov <ddvamp007@gmail.com>
+// Copyright (C) 2023-2026 Artyom Kolpakov <ddvamp007@gmail.com>
 //
 // Licensed under GNU GPL-3.0-or-later.
 // See file LICENSE or <https://www.gnu.org/licenses/> for details.
@@ -137,7 +137,7 @@ class Event {
         }
       }
 
-      static_cast<Waiter &&>(*waiter).handle.Schedule();
+      static_cast<Waiter &&>(*waiter).handle.Wake();
       waiter = next;
     } while (waiter != &dummy_);
   }
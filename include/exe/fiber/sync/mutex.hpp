@@ -15,13 +15,16 @@
 #include <exe/fiber/core/awaiter.hpp>
 #include <exe/fiber/core/handle.hpp>
 
+#include <concurrency/pause.hpp>
 #include <concurrency/intrusive/forward_list.hpp>
 #include <util/debug.hpp>
 #include <util/macro.hpp>
 #include <util/utility.hpp>
 #include <util/mm/release_sequence.hpp>
 
+#include <algorithm>
 #include <atomic>
+#include <cstdint>
 #include <mutex> // IWYU pragma: export - std::lock_guard, std::unique_lock
 #include <new>
 
@@ -29,6 +32,22 @@ namespace exe::fiber {
 
 class Condvar;
 
+// Outcome of spinning in Mutex::Lock, summed over all mutexes
+struct MutexSpinStats {
+  ::std::uint64_t attempts;
+  ::std::uint64_t successes;
+};
+
+namespace detail {
+
+// Counted per thread, so that spinning threads do not share a cache line
+void CountMutexSpin(bool acquired) noexcept;
+
+} // namespace detail
+
+// Values may be stale
+[[nodiscard]] MutexSpinStats GetMutexSpinStats() noexcept;
+
 class alignas (::std::hardware_destructive_interference_size) Mutex {
   friend class Condvar;
 
@@ -50,12 +69,22 @@ class alignas (::std::hardware_destructive_interference_size) Mutex {
 
   using Node = FiberInfo::Node;
 
+  // Upper bound of spins, the actual one adapts to the past successes
+  inline static constexpr ::std::uint32_t kMaxSpins = 256;
+
   Node dummy_{.next_ = &dummy_};
   Node *head_ = &dummy_;
   ::std::atomic<Node *> tail_ = &dummy_;
 
+  // Run of the owner, spinning makes sense only while it goes on
+  ::std::atomic<::std::atomic_uint64_t const *> owner_switches_ = nullptr;
+  ::std::atomic_uint64_t owner_epoch_ = 0;
+  ::std::atomic_uint32_t spin_estimate_ = 0;
+
   // To guarantee the expected implementation
   static_assert(::std::atomic<Node *>::is_always_lock_free);
+  static_assert(
+      ::std::atomic<::std::atomic_uint64_t const *>::is_always_lock_free);
 
  public:
   ~Mutex() {
@@ -72,21 +101,31 @@ class alignas (::std::hardware_destructive_interference_size) Mutex {
   constexpr Mutex() = default;
 
   [[nodiscard]] bool TryLock() noexcept {
-    if (IsLocked()) [[unlikely]] {
+    if (!TryAcquire()) [[unlikely]] {
       return false;
     }
 
-    return dummy_.next_.compare_exchange_weak(::util::temporary(&dummy_),
-                                              nullptr,
-                                              ::std::memory_order_acquire,
-                                              ::std::memory_order_relaxed);
+    ForgetOwner();
+    return true;
   }
 
+  /**
+   *  If the mutex is locked by a fiber that is running on another thread,
+   *  spins for a while before suspending, as a short critical section
+   *  is likely to end sooner than a suspension and rescheduling
+   */
   void Lock() noexcept {
-    if (!TryLock()) [[unlikely]] {
+    if (TryAcquire()) [[likely]] {
+      ForgetOwner();
+      return;
+    }
+
+    if (!TrySpinLock()) {
       LockAwaiter awaiter(*this);
       self::Suspend(awaiter);
     }
+
+    MarkOwner();
   }
 
   void Unlock() noexcept {
@@ -119,6 +158,81 @@ class alignas (::std::hardware_destructive_interference_size) Mutex {
     return dummy_.Next() != &dummy_;
   }
 
+  [[nodiscard]] bool TryAcquire() noexcept {
+    if (IsLocked()) [[unlikely]] {
+      return false;
+    }
+
+    return dummy_.next_.compare_exchange_weak(::util::temporary(&dummy_),
+                                              nullptr,
+                                              ::std::memory_order_acquire,
+                                              ::std::memory_order_relaxed);
+  }
+
+  // The owner is marked only when it acquires a contended mutex, where
+  // the next contender is likely. Otherwise, the mark is left unset
+  void MarkOwner() noexcept {
+    auto const mark = self::GetRunMark();
+    owner_switches_.store(mark.switches, ::std::memory_order_relaxed);
+    owner_epoch_.store(mark.epoch, ::std::memory_order_relaxed);
+  }
+
+  // The mark is on the cache line just acquired, so checking it is cheap
+  void ForgetOwner() noexcept {
+    if (owner_switches_.load(::std::memory_order_relaxed)) [[unlikely]] {
+      owner_switches_.store(nullptr, ::std::memory_order_relaxed);
+    }
+  }
+
+  [[nodiscard]] bool IsOwnerRunningElsewhere() const noexcept {
+    // A torn read may pair the counter of one owner with the epoch of
+    // another, which may stop spinning early or keep it going while no
+    // owner runs. Either way, spinning is bounded by its limit
+    return self::IsRunningElsewhere({
+      .switches = owner_switches_.load(::std::memory_order_relaxed),
+      .epoch = owner_epoch_.load(::std::memory_order_relaxed),
+    });
+  }
+
+  // The limit follows the spins of successful attempts, as in glibc
+  [[nodiscard]] bool TrySpinLock() noexcept {
+    if (!IsOwnerRunningElsewhere()) {
+      return false;
+    }
+
+    auto const estimate = spin_estimate_.load(::std::memory_order_relaxed);
+    auto const limit = ::std::min(kMaxSpins, 2 * estimate + 16);
+
+    for (auto spins = 0u; spins != limit; ++spins) {
+      ::concurrency::Pause();
+
+      if (TryAcquire()) {
+        UpdateSpinEstimate(estimate, spins);
+        detail::CountMutexSpin(true);
+        return true;
+      }
+
+      if (!IsOwnerRunningElsewhere()) {
+        // Says nothing about the hold time, so the estimate is kept
+        detail::CountMutexSpin(false);
+        return false;
+      }
+    }
+
+    UpdateSpinEstimate(estimate, limit);
+    detail::CountMutexSpin(false);
+    return false;
+  }
+
+  void UpdateSpinEstimate(::std::uint32_t const estimate,
+                          ::std::uint32_t const spins) noexcept {
+    auto const delta = (static_cast<::std::int32_t>(spins) -
+                        static_cast<::std::int32_t>(estimate)) / 8;
+    spin_estimate_.store(static_cast<::std::uint32_t>(
+                             static_cast<::std::int32_t>(estimate) + delta),
+                         ::std::memory_order_relaxed);
+  }
+
   FiberHandle LockImpl(FiberInfo *self) noexcept {
     auto const owner = tail_.exchange(self, ::std::memory_order_acq_rel)->
                        next_.exchange(self, ::std::memory_order_relaxed);
@@ -0,0 +1,95 @@
+//
+// parking_lot.hpp
+// ~~~~~~~~~~~~~~~
+//
+// Copyright (C) 2026 Artyom Kolpakov <ddvamp007@gmail.com>
+//
+// Licensed under GNU GPL-3.0-or-later.
+// See file LICENSE or <https://www.gnu.org/licenses/> for details.
+//
+
+#ifndef DDVAMP_EXE_FIBER_SYNC_PARKING_LOT_HPP_INCLUDED_
+#define DDVAMP_EXE_FIBER_SYNC_PARKING_LOT_HPP_INCLUDED_ 1
+
+#include <cstddef>
+#include <functional>
+#include <type_traits>
+
+/**
+ *  Address-keyed wait queues for fibers, analogue of futex. Waiters are kept
+ *  in a global sharded table, so a primitive built on the parking lot needs
+ *  no storage for waiters and may be a single atomic word. Any address may be
+ *  used as a key, usually the address of that word
+ */
+
+namespace exe::fiber {
+
+struct UnparkResult {
+  // Number of fibers unparked by the call
+  ::std::size_t unparked;
+  // Whether fibers parked on the address remain
+  bool has_more;
+};
+
+namespace detail {
+
+using ParkValidate = bool (*)(void *) noexcept;
+using UnparkCallback = void (*)(void *, UnparkResult) noexcept;
+
+bool Park(void const *addr, ParkValidate validate, void *ctx) noexcept;
+
+UnparkResult UnparkOne(void const *addr, UnparkCallback callback,
+                       void *ctx) noexcept;
+
+::std::size_t UnparkAll(void const *addr) noexcept;
+
+} // namespace detail
+
+/**
+ *  Suspends the current fiber on addr if validate() returns true. validate
+ *  is called under the lock of the queue, so an unpark after a change that
+ *  makes validate fail cannot be missed. Returns false if validate failed,
+ *  otherwise true after the fiber was unparked
+ *
+ *  Precondition: in fiber context
+ */
+template <typename Validate>
+  requires (::std::is_nothrow_invocable_r_v<bool, Validate &>)
+bool Park(void const *const addr, Validate validate) noexcept {
+  return detail::Park(
+      addr,
+      [](void *const ctx) noexcept -> bool {
+        return ::std::invoke(*static_cast<Validate *>(ctx));
+      },
+      &validate);
+}
+
+/**
+ *  Unparks the fiber parked on addr first, if any. callback(result) is
+ *  called under the lock of the queue before the fiber is resumed, so
+ *  the state can be updated consistently with the queue (e.g. clearing
+ *  a "has waiters" bit when result.has_more is false)
+ */
+template <typename Callback>
+  requires (::std::is_nothrow_invocable_v<Callback &, UnparkResult>)
+UnparkResult UnparkOne(void const *const addr, Callback callback) noexcept {
+  return detail::UnparkOne(
+      addr,
+      [](void *const ctx, UnparkResult const result) noexcept {
+        ::std::invoke(*static_cast<Callback *>(ctx), result);
+      },
+      &callback);
+}
+
+inline UnparkResult UnparkOne(void const *const addr) noexcept {
+  return detail::UnparkOne(addr, nullptr, nullptr);
+}
+
+// Unparks all fibers parked on addr, returns their number
+inline ::std::size_t UnparkAll(void const *const addr) noexcept {
+  return detail::UnparkAll(addr);
+}
+
+} // namespace exe::fiber
+
+#endif /* DDVAMP_EXE_FIBER_SYNC_PARKING_LOT_HPP_INCLUDED_ */
@@ -0,0 +1,202 @@
+//
+// semaphore.hpp
+// ~~~~~~~~~~~~~
+//
+// Copyright (C) 2026 Artyom Kolpakov <ddvamp007@gmail.com>
+//
+// Licensed under GNU GPL-3.0-or-later.
+// See file LICENSE or <https://www.gnu.org/licenses/> for details.
+//
+
+#ifndef DDVAMP_EXE_FIBER_SYNC_SEMAPHORE_HPP_INCLUDED_
+#define DDVAMP_EXE_FIBER_SYNC_SEMAPHORE_HPP_INCLUDED_ 1
+
+#include <exe/fiber/api.hpp>
+#include <exe/fiber/core/awaiter.hpp>
+#include <exe/fiber/core/handle.hpp>
+
+#include <concurrency/qspinlock.hpp>
+#include <concurrency/intrusive/forward_list.hpp>
+#include <util/debug/assert.hpp>
+#include <util/intrusive/queue.hpp>
+
+#include <atomic>
+#include <cstdint>
+#include <utility>
+
+namespace exe::fiber {
+
+/**
+ *  Counting semaphore. Without waiters, Acquire and Release are a single
+ *  CAS on the counter. Waiters are served in FIFO order, and permits are
+ *  handed to them directly by Release, so newcomers cannot barge in while
+ *  anyone is waiting. The lock of the waiter queue is only taken then
+ */
+class Semaphore {
+ private:
+  using Count = ::std::uint64_t;
+  using State = ::std::uint64_t;
+
+  // State is the number of permits shifted by one and the flag,
+  // which is set only under the lock and iff the queue is not empty
+  inline static constexpr State kHasWaiters = 1;
+  inline static constexpr State kPermit = 2;
+
+  struct Waiter final
+      : IAwaiter
+      , ::concurrency::IntrusiveForwardListNode<Waiter> {
+    Semaphore &semaphore;
+    Count const count;
+    FiberHandle handle;
+
+    Waiter(Semaphore &semaphore, Count const count) noexcept
+        : semaphore(semaphore)
+        , count(count) {}
+
+    FiberHandle AwaitSymmetricSuspend(FiberHandle &&self) noexcept override {
+      handle = ::std::move(self);
+      return semaphore.Enqueue(*this);
+    }
+  };
+
+  ::std::atomic<State> state_;
+  ::concurrency::QSpinlock lock_; // Protects waiters_
+  ::util::intrusive_queue<Waiter> waiters_;
+
+  // To guarantee the expected implementation
+  static_assert(::std::atomic<State>::is_always_lock_free);
+
+ public:
+  ~Semaphore() {
+    UTIL_ASSERT(!(state_.load(::std::memory_order_relaxed) & kHasWaiters),
+                "Semaphore is destroyed during use");
+  }
+
+  Semaphore(Semaphore const &) = delete;
+  void operator= (Semaphore const &) = delete;
+
+  Semaphore(Semaphore &&) = delete;
+  void operator= (Semaphore &&) = delete;
+
+ public:
+  explicit Semaphore(Count const permits) noexcept
+      : state_(permits * kPermit) {}
+
+  [[nodiscard]] bool TryAcquire(Count const count = 1) noexcept {
+    auto state = state_.load(::std::memory_order_relaxed);
+    while (!(state & kHasWaiters) && state >= count * kPermit) {
+      if (state_.compare_exchange_weak(state, state - count * kPermit,
+                                       ::std::memory_order_acquire,
+                                       ::std::memory_order_relaxed)) {
+        return true;
+      }
+    }
+    return false;
+  }
+
+  void Acquire(Count const count = 1) noexcept {
+    if (!TryAcquire(count)) [[unlikely]] {
+      Waiter waiter(*this, count);
+      self::Suspend(waiter);
+    }
+  }
+
+  void Release(Count const count = 1) noexcept {
+    auto state = state_.load(::std::memory_order_relaxed);
+    while (!(state & kHasWaiters)) {
+      if (state_.compare_exchange_weak(state, state + count * kPermit,
+                                       ::std::memory_order_release,
+                                       ::std::memory_order_relaxed)) {
+        // Fast path
+        return;
+      }
+    }
+
+    ReleaseSlow(count);
+  }
+
+ private:
+  FiberHandle Enqueue(Waiter &waiter) noexcept {
+    auto guard = lock_.MakeGuard();
+
+    if (waiters_.empty()) {
+      auto state = state_.load(::std::memory_order_relaxed);
+      while (true) {
+        if (state >= waiter.count * kPermit) {
+          if (state_.compare_exchange_weak(
+                  state, state - waiter.count * kPermit,
+                  ::std::memory_order_acquire, ::std::memory_order_relaxed)) {
+            // Permits were released meanwhile, continue the fiber
+            return ::std::move(waiter.handle);
+          }
+        } else if (state_.compare_exchange_weak(state, state | kHasWaiters,
+                                                ::std::memory_order_relaxed)) {
+          break;
+        }
+      }
+    }
+
+    waiters_.push(waiter);
+    return FiberHandle::Invalid();
+  }
+
+  void ReleaseSlow(Count const count) noexcept {
+    ::util::intrusive_queue<Waiter> ready;
+
+    {
+      auto guard = lock_.MakeGuard();
+
+      // While the flag is set, only the lock holder changes the state
+      auto state = state_.fetch_add(count * kPermit,
+                                    ::std::memory_order_release) +
+                   count * kPermit;
+
+      while (!waiters_.empty() &&
+             state >= waiters_.front().count * kPermit) {
+        auto &waiter = waiters_.pop();
+        state = state_.fetch_sub(waiter.count * kPermit,
+                                 ::std::memory_order_acquire) -
+                waiter.count * kPermit;
+        ready.push(waiter);
+      }
+
+      if (waiters_.empty() && (state & kHasWaiters)) {
+        state_.fetch_and(~kHasWaiters, ::std::memory_order_relaxed);
+      }
+    }
+
+    while (!ready.empty()) {
+      ::std::move(ready.pop().handle).Wake();
+    }
+  }
+};
+
+/* Holds permits of a semaphore for the scope, e.g. to limit concurrency */
+class [[nodiscard]] SemaphoreGuard {
+ private:
+  Semaphore &semaphore_;
+  ::std::uint64_t const count_;
+
+ public:
+  ~SemaphoreGuard() {
+    semaphore_.Release(count_);
+  }
+
+  SemaphoreGuard(SemaphoreGuard const &) = delete;
+  void operator= (SemaphoreGuard const &) = delete;
+
+  SemaphoreGuard(SemaphoreGuard &&) = delete;
+  void operator= (SemaphoreGuard &&) = delete;
+
+ public:
+  explicit SemaphoreGuard(Semaphore &semaphore,
+                          ::std::uint64_t const count = 1) noexcept
+      : semaphore_(semaphore)
+      , count_(count) {
+    semaphore_.Acquire(count_);
+  }
+};
+
+} // namespace exe::fiber
+
+#endif /* DDVAMP_EXE_FIBER_SYNC_SEMAPHORE_HPP_INCLUDED_ */
@@ -0,0 +1,210 @@
+//
+// shared_mutex.hpp
+// ~~~~~~~~~~~~~~~~
+//
+// Copyright (C) 2026 Artyom Kolpakov <ddvamp007@gmail.com>
+//
+// Licensed under GNU GPL-3.0-or-later.
+// See file LICENSE or <https://www.gnu.org/licenses/> for details.
+//
+
+#ifndef DDVAMP_EXE_FIBER_SYNC_SHARED_MUTEX_HPP_INCLUDED_
+#define DDVAMP_EXE_FIBER_SYNC_SHARED_MUTEX_HPP_INCLUDED_ 1
+
+#include <exe/fiber/sync/parking_lot.hpp>
+
+#include <util/debug/assert.hpp>
+
+#include <atomic>
+#include <cstdint>
+#include <mutex> // IWYU pragma: export - std::lock_guard, std::unique_lock
+#include <shared_mutex> // IWYU pragma: export - std::shared_lock
+
+namespace exe::fiber {
+
+/**
+ *  Reader-writer mutex in a single atomic word, waiters are kept in
+ *  the parking lot. Writers are preferred: new readers wait while a writer
+ *  is waiting, and an unlocking writer wakes the next writer rather than
+ *  the readers. The mutex is not handed over, so the woken writer competes
+ *  with newcomers, which may lock first. If no writer waits, all waiting
+ *  readers are woken at once
+ */
+class SharedMutex {
+ private:
+  using State = ::std::uint64_t;
+
+  inline static constexpr State kWriter = 1;
+  inline static constexpr State kWritersWaiting = 2;
+  inline static constexpr State kReadersWaiting = 4;
+  inline static constexpr State kReader = 8; // Number of readers is above
+
+  ::std::atomic<State> state_ = 0;
+
+  // To guarantee the expected implementation
+  static_assert(::std::atomic<State>::is_always_lock_free);
+
+ public:
+  ~SharedMutex() {
+    // Waiting flags may be left behind by fibers that locked after all
+    UTIL_ASSERT(CanLock(state_.load(::std::memory_order_relaxed)),
+                "SharedMutex is destroyed during use");
+  }
+
+  SharedMutex(SharedMutex const &) = delete;
+  void operator= (SharedMutex const &) = delete;
+
+  SharedMutex(SharedMutex &&) = delete;
+  void operator= (SharedMutex &&) = delete;
+
+ public:
+  constexpr SharedMutex() = default;
+
+  [[nodiscard]] bool TryLock() noexcept {
+    auto state = state_.load(::std::memory_order_relaxed);
+    while (CanLock(state)) {
+      if (state_.compare_exchange_weak(state, state | kWriter,
+                                       ::std::memory_order_acquire,
+                                       ::std::memory_order_relaxed)) {
+        return true;
+      }
+    }
+    return false;
+  }
+
+  void Lock() noexcept {
+    while (!TryLock()) {
+      // Writers waiting block new readers, so the current ones drain
+      auto state = state_.fetch_or(kWritersWaiting,
+                                   ::std::memory_order_relaxed);
+      if (CanLock(state)) {
+        continue;
+      }
+
+      Park(WritersAddr(), [this] noexcept {
+        auto const state = state_.load(::std::memory_order_relaxed);
+        return (state & kWritersWaiting) && !CanLock(state);
+      });
+    }
+  }
+
+  void Unlock() noexcept {
+    auto const state = state_.fetch_and(~kWriter, ::std::memory_order_release);
+    UTIL_ASSERT(state & kWriter, "Unlocking an unlocked SharedMutex");
+
+    if (state & (kWritersWaiting | kReadersWaiting)) [[unlikely]] {
+      WakeWaiters(state);
+    }
+  }
+
+  [[nodiscard]] bool TryLockShared() noexcept {
+    auto state = state_.load(::std::memory_order_relaxed);
+    while (CanLockShared(state)) {
+      if (state_.compare_exchange_weak(state, state + kReader,
+                                       ::std::memory_order_acquire,
+                                       ::std::memory_order_relaxed)) {
+        return true;
+      }
+    }
+    return false;
+  }
+
+  void LockShared() noexcept {
+    while (!TryLockShared()) {
+      auto state = state_.fetch_or(kReadersWaiting,
+                                   ::std::memory_order_relaxed);
+      if (CanLockShared(state)) {
+        continue;
+      }
+
+      Park(ReadersAddr(), [this] noexcept {
+        auto const state = state_.load(::std::memory_order_relaxed);
+        return (state & kReadersWaiting) && !CanLockShared(state);
+      });
+    }
+  }
+
+  void UnlockShared() noexcept {
+    auto const state = state_.fetch_sub(kReader, ::std::memory_order_release);
+    UTIL_ASSERT(state >= kReader, "Unlocking an unlocked SharedMutex");
+
+    // Readers only wait for writers, so the last reader wakes them
+    if (state / kReader == 1 && (state & kWritersWaiting)) [[unlikely]] {
+      WakeWaiters(state);
+    }
+  }
+
+  // Cpp17Lockable
+  // https://eel.is/c++draft/thread.req.lockable.req
+
+  [[nodiscard]] bool try_lock() noexcept {
+    return TryLock();
+  }
+
+  void lock() noexcept {
+    Lock();
+  }
+
+  void unlock() noexcept {
+    Unlock();
+  }
+
+  // Cpp17SharedLockable
+  // https://eel.is/c++draft/thread.sharedmutex.requirements.general
+
+  [[nodiscard]] bool try_lock_shared() noexcept {
+    return TryLockShared();
+  }
+
+  void lock_shared() noexcept {
+    LockShared();
+  }
+
+  void unlock_shared() noexcept {
+    UnlockShared();
+  }
+
+ private:
+  [[nodiscard]] static bool CanLock(State const state) noexcept {
+    return !(state & kWriter) && state < kReader;
+  }
+
+  [[nodiscard]] static bool CanLockShared(State const state) noexcept {
+    return !(state & (kWriter | kWritersWaiting));
+  }
+
+  [[nodiscard]] void const *ReadersAddr() const noexcept {
+    return &state_;
+  }
+
+  // Any address that differs from ReadersAddr
+  [[nodiscard]] void const *WritersAddr() const noexcept {
+    return reinterpret_cast<char const *>(&state_) + 1;
+  }
+
+  // Wakes one writer, or all readers if there is no writer to wake
+  void WakeWaiters(State const state) noexcept {
+    if (state & kWritersWaiting) {
+      auto const result = UnparkOne(WritersAddr(),
+          [this](UnparkResult const result) noexcept {
+            if (!result.has_more) {
+              state_.fetch_and(~kWritersWaiting, ::std::memory_order_relaxed);
+            }
+          });
+      if (result.unparked != 0) {
+        return;
+      }
+    }
+
+    // A parked reader validates the flag under the lock of its queue,
+    // so it is either woken below or does not park
+    if (state_.fetch_and(~kReadersWaiting, ::std::memory_order_relaxed) &
+        kReadersWaiting) {
+      UnparkAll(ReadersAddr());
+    }
+  }
+};
+
+} // namespace exe::fiber
+
+#endif /* DDVAMP_EXE_FIBER_SYNC_SHARED_MUTEX_HPP_INCLUDED_ */
@@ -0,0 +1,330 @@
+//
+// acceptor.hpp
+// ~~~~~~~~~~~~
+//
+// Copyright (C) 2026 Artyom Kolpakov <ddvamp007@gmail.com>
+//
+// Licensed under GNU GPL-3.0-or-later.
+// See file LICENSE or <https://www.gnu.org/licenses/> for details.
+//
+
+#ifndef DDVAMP_EXE_RUNTIME_ACCEPTOR_HPP_INCLUDED_
+#define DDVAMP_EXE_RUNTIME_ACCEPTOR_HPP_INCLUDED_ 1
+
+#include <exe/runtime/reactor.hpp>
+#include <exe/runtime/timer_queue.hpp>
+
+#include <concurrency/intrusive/forward_list.hpp>
+#include <util/debug/assert.hpp>
+#include <util/macro.hpp>
+#include <util/mm/single_writer.hpp>
+
+#include <unistd.h> // close, read, write
+#include <sys/epoll.h>
+#include <sys/eventfd.h>
+#include <sys/socket.h>
+
+#include <array>
+#include <atomic>
+#include <cerrno>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <new>
+#include <span>
+#include <system_error>
+#include <utility>
+#include <vector>
+
+namespace exe::runtime {
+
+struct ConnectionBatch
+    : ::concurrency::IntrusiveForwardListNode<ConnectionBatch> {
+  inline static constexpr ::std::size_t kCapacity = 64;
+
+  ::std::array<int, kCapacity> fds;
+  ::std::size_t count = 0;
+
+  [[nodiscard]] bool IsFull() const noexcept {
+    return count == kCapacity;
+  }
+
+  [[nodiscard]] ::std::span<int const> Fds() const noexcept {
+    return {fds.data(), count};
+  }
+};
+
+/**
+ *  Receiving side of connections accepted on another thread. Batches are
+ *  pushed to a lock-free stack, and only a push to the empty stack rings
+ *  the eventfd, so the worker reactor wakes up at most once per batch
+ */
+class ConnectionHandoff : private Operation {
+ private:
+  ::std::atomic<ConnectionBatch *> head_ = nullptr;
+  int event_fd_ = -1;
+
+  // To guarantee the expected implementation
+  static_assert(::std::atomic<ConnectionBatch *>::is_always_lock_free);
+
+ protected:
+  // Connections that are not handled yet are closed
+  ~ConnectionHandoff() {
+    Close();
+    Drain([](int const fd) noexcept { ::close(fd); });
+  }
+
+ public:
+  ConnectionHandoff(ConnectionHandoff const &) = delete;
+  void operator= (ConnectionHandoff const &) = delete;
+
+  ConnectionHandoff(ConnectionHandoff &&) = delete;
+  void operator= (ConnectionHandoff &&) = delete;
+
+ public:
+  ConnectionHandoff() noexcept = default;
+
+  // Takes ownership of accepted fds, called on the worker reactor thread
+  virtual void OnConnection(int fd) noexcept = 0;
+
+  // Throws: std::system_error
+  void Init(Reactor &worker) {
+    event_fd_ = ::eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+    if (event_fd_ == -1) [[unlikely]] {
+      ThrowErrno();
+    }
+
+    auto const ec = worker.AddFd(event_fd_, EPOLLIN | EPOLLET, *this);
+    if (ec) [[unlikely]] {
+      Close();
+      ThrowErrorCode(ec);
+    }
+  }
+
+  // Worker reactor must not be polled concurrently
+  void Close() noexcept {
+    if (event_fd_ != -1) {
+      ::close(::std::exchange(event_fd_, -1));
+    }
+  }
+
+  // Takes ownership of batch, may be called from any thread
+  void Push(ConnectionBatch *const batch) noexcept {
+    UTIL_ASSERT(batch && batch->count != 0, "Empty batch");
+
+    auto head = head_.load(::std::memory_order_relaxed);
+    do {
+      batch->Link(head);
+    } while (!head_.compare_exchange_weak(head, batch,
+                                          ::std::memory_order_release,
+                                          ::std::memory_order_relaxed));
+
+    if (!head) {
+      Ring();
+    }
+  }
+
+ private:
+  void Ring() noexcept {
+    ::std::uint64_t one = 1;
+    [[maybe_unused]] auto const res = ::write(event_fd_, &one, sizeof(one));
+  }
+
+  // Operation
+  void OnEvent(::std::uint32_t) noexcept override {
+    // Reset before taking batches, so that a push to the empty stack
+    // after this point generates a new event
+    ::std::uint64_t val;
+    [[maybe_unused]] auto const res = ::read(event_fd_, &val, sizeof(val));
+
+    Drain([this](int const fd) noexcept { OnConnection(fd); });
+  }
+
+  template <typename Fn>
+  void Drain(Fn fn) noexcept {
+    auto batch = head_.exchange(nullptr, ::std::memory_order_acquire);
+
+    // Restore FIFO order
+    ConnectionBatch *fifo = nullptr;
+    while (batch) {
+      auto const next = batch->Next();
+      batch->Link(fifo);
+      fifo = ::std::exchange(batch, next);
+    }
+
+    while (fifo) {
+      for (auto const fd : fifo->Fds()) {
+        fn(fd);
+      }
+      delete ::std::exchange(fifo, fifo->Next());
+    }
+  }
+};
+
+/**
+ *  Accepts connections on a non-blocking listening socket. Each readiness
+ *  event drains the backlog with accept4 (at most kMaxAcceptsPerEvent) and
+ *  distributes the new fds between workers in batches, round-robin.
+ *  Accepted fds are non-blocking and close-on-exec
+ *
+ *  When the process runs out of fds or memory, the pending connection stays
+ *  in the backlog and the level-triggered listener would be reported again
+ *  right away. Instead, the listener is disarmed for kErrorBackoff
+ */
+class Acceptor : private Operation, private TimerOperation {
+ public:
+  struct Stats {
+    ::std::uint64_t accepted;
+    ::std::uint64_t batches;
+    // Readiness events, accepted / wakeups is the mean batching factor
+    ::std::uint64_t wakeups;
+    // Failed accepts other than an empty backlog
+    ::std::uint64_t errors;
+    // Times the listener was disarmed after running out of resources
+    ::std::uint64_t backoffs;
+  };
+
+  inline static constexpr ::std::size_t kMaxAcceptsPerEvent = 256;
+  inline static constexpr auto kErrorBackoff = ::std::chrono::milliseconds(10);
+
+ private:
+  Reactor &reactor_;
+  int const listen_fd_;
+  ::std::vector<ConnectionHandoff *> workers_;
+  ::std::size_t next_worker_ = 0;
+
+  // Written only by the polling thread, may be read by any
+  ::std::atomic_uint64_t accepted_ = 0;
+  ::std::atomic_uint64_t batches_ = 0;
+  ::std::atomic_uint64_t wakeups_ = 0;
+  ::std::atomic_uint64_t errors_ = 0;
+  ::std::atomic_uint64_t backoffs_ = 0;
+
+  // To guarantee the expected implementation
+  static_assert(::std::atomic_uint64_t::is_always_lock_free);
+
+ public:
+  ~Acceptor() = default;
+
+  Acceptor(Acceptor const &) = delete;
+  void operator= (Acceptor const &) = delete;
+
+  Acceptor(Acceptor &&) = delete;
+  void operator= (Acceptor &&) = delete;
+
+ public:
+  // Throws: std::bad_alloc
+  Acceptor(Reactor &reactor, int const listen_fd,
+           ::std::span<ConnectionHandoff *const> const workers)
+      : reactor_(reactor)
+      , listen_fd_(listen_fd)
+      , workers_(workers.begin(), workers.end()) {
+    UTIL_ASSERT(!workers_.empty(), "No workers");
+  }
+
+  // Level-triggered, so the rest of a bounded drain is reported again
+  [[nodiscard]] ::std::error_code Start() noexcept {
+    return reactor_.AddFd(listen_fd_, EPOLLIN, *this);
+  }
+
+  // Called on the polling thread
+  [[nodiscard]] ::std::error_code Stop() noexcept {
+    UTIL_IGNORE(reactor_.CancelTimer(*this));
+    return reactor_.DelFd(listen_fd_);
+  }
+
+  // Values may be stale
+  [[nodiscard]] Stats GetStats() const noexcept {
+    return {
+      .accepted = accepted_.load(::std::memory_order_relaxed),
+      .batches = batches_.load(::std::memory_order_relaxed),
+      .wakeups = wakeups_.load(::std::memory_order_relaxed),
+      .errors = errors_.load(::std::memory_order_relaxed),
+      .backoffs = backoffs_.load(::std::memory_order_relaxed),
+    };
+  }
+
+ private:
+  // Operation
+  void OnEvent(::std::uint32_t) noexcept override {
+    ::util::single_writer_increment(wakeups_);
+
+    ConnectionBatch *batch = nullptr;
+    ::std::size_t accepted = 0;
+
+    for (auto idx = 0uz; idx != kMaxAcceptsPerEvent; ++idx) {
+      if (!batch) {
+        batch = new (::std::nothrow) ConnectionBatch;
+        if (!batch) [[unlikely]] {
+          // Leave the rest in backlog until the backoff expires
+          ::util::single_writer_increment(errors_);
+          Backoff();
+          break;
+        }
+      }
+
+      auto const fd = ::accept4(listen_fd_, nullptr, nullptr,
+                                SOCK_NONBLOCK | SOCK_CLOEXEC);
+
+      if (fd == -1) [[unlikely]] {
+        if (errno == EAGAIN || errno == EWOULDBLOCK) {
+          break;
+        }
+        if (errno == EINTR || errno == ECONNABORTED) {
+          continue;
+        }
+        ::util::single_writer_increment(errors_);
+        if (errno == EMFILE || errno == ENFILE || errno == ENOBUFS ||
+            errno == ENOMEM) {
+          Backoff();
+        }
+        break;
+      }
+
+      ++accepted;
+      batch->fds[batch->count++] = fd;
+      if (batch->IsFull()) {
+        HandOff(::std::exchange(batch, nullptr));
+      }
+    }
+
+    if (batch && batch->count != 0) {
+      HandOff(batch);
+    } else {
+      delete batch;
+    }
+
+    ::util::single_writer_add(accepted_, accepted);
+  }
+
+  // TimerOperation
+  void OnTimer() noexcept override {
+    UTIL_IGNORE(reactor_.ModFd(listen_fd_, EPOLLIN, *this));
+  }
+
+  void HandOff(ConnectionBatch *const batch) noexcept {
+    workers_[next_worker_]->Push(batch);
+    next_worker_ = (next_worker_ + 1) % workers_.size();
+    ::util::single_writer_increment(batches_);
+  }
+
+  void Backoff() noexcept {
+    if (IsPending()) {
+      return;
+    }
+
+    try {
+      reactor_.AddTimer(*this, kErrorBackoff);
+    } catch (::std::bad_alloc const &) {
+      // Keep the listener armed rather than never rearm it
+      return;
+    }
+
+    UTIL_IGNORE(reactor_.ModFd(listen_fd_, 0, *this));
+    ::util::single_writer_increment(backoffs_);
+  }
+};
+
+} // namespace exe::runtime
+
+#endif /* DDVAMP_EXE_RUNTIME_ACCEPTOR_HPP_INCLUDED_ */
@@ -0,0 +1,315 @@
+//
+// buffer_pool.hpp
+// ~~~~~~~~~~~~~~~
+//
+// Copyright (C) 2026 Artyom Kolpakov <ddvamp007@gmail.com>
+//
+// Licensed under GNU GPL-3.0-or-later.
+// See file LICENSE or <https://www.gnu.org/licenses/> for details.
+//
+
+#ifndef DDVAMP_EXE_RUNTIME_BUFFER_POOL_HPP_INCLUDED_
+#define DDVAMP_EXE_RUNTIME_BUFFER_POOL_HPP_INCLUDED_ 1
+
+#include <concurrency/qspinlock.hpp>
+#include <util/debug/assert.hpp>
+#include <util/intrusive/forward_list.hpp>
+#include <util/intrusive/stack.hpp>
+#include <util/memory/page_allocation.hpp>
+#include <util/memory/view.hpp>
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <utility>
+#include <vector>
+
+namespace exe::runtime {
+
+class BufferPool;
+
+// Index of a buffer inside its pool, stable for the pool lifetime
+using BufferId = ::std::uint32_t;
+
+namespace detail {
+
+struct BufferBlock : ::util::intrusive_forward_list_node<BufferBlock> {
+  ::std::atomic_size_t refs = 0;
+  BufferPool *pool;
+  ::std::byte *data;
+  BufferId id;
+
+  // To guarantee the expected implementation
+  static_assert(::std::atomic_size_t::is_always_lock_free);
+};
+
+void ReleaseBlock(BufferBlock *block) noexcept;
+
+} // namespace detail
+
+/**
+ *  Reference-counted view of a part of a pooled buffer. Copies and slices
+ *  share the same buffer, which returns to the pool when the last of them
+ *  is destroyed. Data must not be modified while it is shared
+ */
+class [[nodiscard]] Buffer {
+  friend class BufferPool;
+
+ private:
+  using Block = detail::BufferBlock;
+
+  Block *block_ = nullptr;
+  ::std::size_t offset_ = 0;
+  ::std::size_t size_ = 0;
+
+ public:
+  ~Buffer() {
+    Reset();
+  }
+
+  Buffer(Buffer const &that) noexcept
+      : block_(that.block_)
+      , offset_(that.offset_)
+      , size_(that.size_) {
+    IncRef();
+  }
+
+  Buffer(Buffer &&that) noexcept
+      : block_(::std::exchange(that.block_, nullptr))
+      , offset_(::std::exchange(that.offset_, 0))
+      , size_(::std::exchange(that.size_, 0)) {}
+
+  Buffer &operator= (Buffer that) noexcept {
+    Swap(that);
+    return *this;
+  }
+
+ public:
+  Buffer() noexcept = default;
+
+  explicit operator bool() const noexcept {
+    return block_;
+  }
+
+  [[nodiscard]] ::std::byte *Data() const noexcept {
+    UTIL_ASSERT(block_, "Empty buffer");
+    return block_->data + offset_;
+  }
+
+  [[nodiscard]] ::std::size_t Size() const noexcept {
+    return size_;
+  }
+
+  [[nodiscard]] ::util::memory_view View() const noexcept {
+    return {Data(), size_};
+  }
+
+  [[nodiscard]] BufferId GetId() const noexcept {
+    UTIL_ASSERT(block_, "Empty buffer");
+    return block_->id;
+  }
+
+  // It may return a stale value
+  [[nodiscard]] bool IsUnique() const noexcept {
+    return block_ && block_->refs.load(::std::memory_order_relaxed) == 1;
+  }
+
+  // Shares the buffer, offset is relative to this slice
+  [[nodiscard]] Buffer Slice(::std::size_t const offset,
+                             ::std::size_t const size) const & noexcept {
+    return Buffer(*this).Slice(offset, size);
+  }
+
+  [[nodiscard]] Buffer Slice(::std::size_t const offset,
+                             ::std::size_t const size) && noexcept {
+    UTIL_ASSERT(offset <= size_ && size <= size_ - offset,
+                "Slice is out of range");
+    offset_ += offset;
+    size_ = size;
+    return ::std::move(*this);
+  }
+
+  // Shrinks the view, e.g. to the number of bytes read
+  void Truncate(::std::size_t const size) noexcept {
+    UTIL_ASSERT(size <= size_, "Truncate beyond the end");
+    size_ = size;
+  }
+
+  /**
+   *  Transfers ownership of the buffer to the caller, e.g. to provide
+   *  the buffer to the kernel. BufferPool::Attach takes it back
+   *
+   *  Precondition: IsUnique()
+   */
+  [[nodiscard]] BufferId Detach() && noexcept {
+    UTIL_ASSERT(IsUnique(), "Detaching a shared buffer");
+    auto const id = block_->id;
+    block_ = nullptr;
+    offset_ = size_ = 0;
+    return id;
+  }
+
+  void Reset() noexcept {
+    if (auto const block = ::std::exchange(block_, nullptr)) {
+      offset_ = size_ = 0;
+      DecRef(block);
+    }
+  }
+
+  void Swap(Buffer &that) noexcept {
+    ::std::swap(block_, that.block_);
+    ::std::swap(offset_, that.offset_);
+    ::std::swap(size_, that.size_);
+  }
+
+ private:
+  Buffer(Block *block, ::std::size_t size) noexcept
+      : block_(block)
+      , size_(size) {}
+
+  void IncRef() const noexcept {
+    if (block_) {
+      block_->refs.fetch_add(1, ::std::memory_order_relaxed);
+    }
+  }
+
+  static void DecRef(Block *block) noexcept {
+    if (block->refs.fetch_sub(1, ::std::memory_order_acq_rel) == 1) {
+      detail::ReleaseBlock(block);
+    }
+  }
+};
+
+/**
+ *  Pool of fixed-size I/O buffers. Buffers are carved from page-aligned
+ *  slabs that are never released while the pool is alive, so slabs can be
+ *  registered in the kernel (e.g. io_uring registered/provided buffers)
+ *
+ *  Threads with a ThreadCache acquire and release buffers without touching
+ *  shared state in the common case
+ */
+class BufferPool {
+  friend void detail::ReleaseBlock(detail::BufferBlock *) noexcept;
+
+ public:
+  class ThreadCache;
+
+ private:
+  using Block = detail::BufferBlock;
+
+  ::std::size_t const buffer_size_;
+  ::std::size_t const buffers_per_slab_;
+  ::std::size_t const max_slabs_;
+  ::std::unique_ptr<::util::page_allocation[]> slabs_;
+
+  ::concurrency::QSpinlock lock_; // Protects fields below
+  ::util::intrusive_stack<Block> free_;
+  ::std::size_t free_count_ = 0;
+  ::std::size_t slab_count_ = 0;
+  ::std::size_t cache_count_ = 0;
+
+ public:
+  // Buffers must not outlive the pool
+  ~BufferPool();
+
+  BufferPool(BufferPool const &) = delete;
+  void operator= (BufferPool const &) = delete;
+
+  BufferPool(BufferPool &&) = delete;
+  void operator= (BufferPool &&) = delete;
+
+ public:
+  inline static constexpr ::std::size_t kBufferAlignment = 64;
+
+  // buffer_size is rounded up to kBufferAlignment
+  explicit BufferPool(::std::size_t buffer_size,
+                      ::std::size_t buffers_per_slab = 64,
+                      ::std::size_t max_slabs = 1024);
+
+  [[nodiscard]] ::std::size_t BufferSize() const noexcept {
+    return buffer_size_;
+  }
+
+  /**
+   *  Returns the whole buffer
+   *
+   *  Throws: std::bad_alloc if the pool is exhausted and
+   *          a new slab cannot be allocated
+   */
+  Buffer Acquire();
+
+  // Same as above, but returns an empty buffer instead of throwing
+  Buffer TryAcquire() noexcept;
+
+  // Takes back the ownership of a detached buffer
+  Buffer Attach(BufferId id) noexcept;
+
+  // Memory of the slabs allocated so far. Buffer id of the i-th buffer
+  // in the j-th slab is j * BuffersPerSlab() + i
+  [[nodiscard]] ::std::vector<::util::memory_view> GetSlabs();
+
+  [[nodiscard]] ::std::size_t BuffersPerSlab() const noexcept {
+    return buffers_per_slab_;
+  }
+
+ private:
+  [[nodiscard]] Block *TryTake() noexcept;
+  void Put(Block *block) noexcept;
+
+  // Returns the block to the thread cache, if any, or to the depot
+  void Release(Block *block) noexcept;
+
+  // Moves up to count free blocks to out, returns the number of moved
+  ::std::size_t TakeBatch(Block **out, ::std::size_t count) noexcept;
+  void PutBatch(Block **blocks, ::std::size_t count) noexcept;
+
+  // Returns false if the pool is exhausted or out of memory
+  bool Grow() noexcept;
+
+  [[nodiscard]] ThreadCache *FindCache() const noexcept;
+
+  [[nodiscard]] Block *GetBlock(BufferId id) const noexcept;
+
+  static Buffer MakeBuffer(Block *block, ::std::size_t size) noexcept;
+};
+
+/**
+ *  Per-thread front cache of a pool. While alive, the pool serves
+ *  acquisitions and releases on the owner thread from the cache, and
+ *  exchanges buffers with the shared depot in batches
+ */
+class BufferPool::ThreadCache {
+  friend class BufferPool;
+
+ private:
+  inline static constexpr ::std::size_t kCapacity = 64;
+  inline static constexpr ::std::size_t kBatch = kCapacity / 2;
+
+  BufferPool &pool_;
+  ThreadCache *next_; // Other caches of this thread
+  ::std::array<Block *, kCapacity> blocks_;
+  ::std::size_t count_ = 0;
+
+ public:
+  // Must be destroyed on the same thread and before the pool
+  ~ThreadCache();
+
+  ThreadCache(ThreadCache const &) = delete;
+  void operator= (ThreadCache const &) = delete;
+
+  ThreadCache(ThreadCache &&) = delete;
+  void operator= (ThreadCache &&) = delete;
+
+ public:
+  explicit ThreadCache(BufferPool &pool) noexcept;
+
+ private:
+  [[nodiscard]] Block *TryTake() noexcept;
+  void Put(Block *block) noexcept;
+};
+
+} // namespace exe::runtime
+
+#endif /* DDVAMP_EXE_RUNTIME_BUFFER_POOL_HPP_INCLUDED_ */
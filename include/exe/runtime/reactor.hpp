@@ -2,7 +2,7 @@
 // reactor.hpp
 // ~~~~~~~~~~~
 //
-// Copyright (C) 2025 Artyom Kolpakov <ddvamp007@gmail.com>
+// Copyright (C) 2025-2026 Artyom Kolpakov <ddvamp007@gmail.com>
 //
 // Licensed under GNU GPL-3.0-or-later.
 // See file LICENSE or <https://www.gnu.org/licenses/> for details.
@@ -11,6 +11,11 @@
 #ifndef DDVAMP_EXE_RUNTIME_REACTOR_HPP_INCLUDED_
 #define DDVAMP_EXE_RUNTIME_REACTOR_HPP_INCLUDED_ 1
 
+#include <exe/runtime/manual_loop.hpp>
+#include <exe/runtime/timer_queue.hpp>
+
+#include <util/mm/single_writer.hpp>
+
 #include <unistd.h> // close, read, write
 #include <sys/epoll.h>
 #include <sys/eventfd.h>
@@ -19,7 +24,11 @@
 #include <atomic>
 #include <cassert>
 #include <cerrno>
+#include <chrono>
+#include <cstddef>
 #include <cstdint>
+#include <limits>
+#include <new>
 #include <ranges>
 #include <system_error>
 #include <utility>
@@ -51,7 +60,22 @@ struct DummyOperation : Operation {
   void OnEvent(::std::uint32_t) noexcept override {}
 };
 
+/**
+ *  Event loop over epoll. Polling, timers and tasks of Run(ManualLoop &) are
+ *  handled on the thread that runs the reactor. Only Stop(), SubmitTimer()
+ *  and fd management may be called from other threads
+ */
 class Reactor {
+ public:
+  using Clock = TimerQueue::Clock;
+
+  struct Stats {
+    // Zero-timeout polls that found neither events nor tasks
+    ::std::uint64_t empty_polls;
+    // Polls that blocked the thread
+    ::std::uint64_t blocking_polls;
+  };
+
  private:
   int epoll_fd_ = -1;
   int wakeup_fd_ = -1; // eventfd
@@ -60,9 +84,23 @@ class Reactor {
   int max_events_ = 0;
   inline static constexpr int kMaxEventsHard = 1024;
 
+  // How long to keep polling without blocking after the last activity
+  Clock::duration busy_poll_ = Clock::duration::zero();
+  // Tasks executed between two polls
+  inline static constexpr ::std::size_t kTasksPerPoll = 64;
+
+  TimerQueue timers_;
+  // Timers submitted from other threads, a lock-free stack
+  ::std::atomic<TimerOperation *> incoming_timers_ = nullptr;
+
   ::std::atomic_bool stop_requested_ = false;
+  // Written only by the polling thread, may be read by any
+  ::std::atomic_uint64_t empty_polls_ = 0;
+  ::std::atomic_uint64_t blocking_polls_ = 0;
+
   // To guarantee the expected implementation
   static_assert(::std::atomic_bool::is_always_lock_free);
+  static_assert(::std::atomic_uint64_t::is_always_lock_free);
 
  public:
   ~Reactor() noexcept = default;
@@ -105,14 +143,39 @@ class Reactor {
     assert(::write(wakeup_fd_, &one, sizeof(one)) == sizeof(one));
   }
 
+  // Waits for events or for the nearest timer
   void PollOnce() noexcept {
-    DoPollOnce(max_events_, -1);
+    Poll(true);
+  }
+
+  /**
+   *  Enables hybrid polling. After any activity, the reactor keeps polling
+   *  with a zero timeout for the specified duration and only then falls back
+   *  to a blocking wait. This trades CPU time for lower wakeup latency.
+   *  Zero (default) means always blocking
+   */
+  void SetBusyPoll(Clock::duration const spin) noexcept {
+    busy_poll_ = ::std::max(spin, Clock::duration::zero());
   }
 
   void Run() noexcept {
-    while (!stop_requested_.load(::std::memory_order_relaxed)) {
-      PollOnce();
-    }
+    RunImpl([] noexcept { return false; });
+  }
+
+  // Interleaves polling with running tasks from loop
+  void Run(ManualLoop &loop) noexcept {
+    RunImpl([&loop] noexcept {
+      loop.RunAtMost(kTasksPerPoll);
+      return !loop.IsEmpty();
+    });
+  }
+
+  // Values may be stale
+  [[nodiscard]] Stats GetStats() const noexcept {
+    return {
+      .empty_polls = empty_polls_.load(::std::memory_order_relaxed),
+      .blocking_polls = blocking_polls_.load(::std::memory_order_relaxed),
+    };
   }
 
   void Reset() noexcept {
@@ -126,6 +189,45 @@ class Reactor {
     CloseFd(epoll_fd_);
   }
 
+  /* timers, must be managed from the polling thread */
+
+  // Throws: std::bad_alloc
+  void AddTimer(TimerOperation &op, Clock::time_point const deadline) {
+    timers_.Add(op, deadline);
+  }
+
+  // Throws: std::bad_alloc
+  void AddTimer(TimerOperation &op, Clock::duration const timeout) {
+    AddTimer(op, Clock::now() + timeout);
+  }
+
+  // Returns false if the timer has already fired or is not added
+  bool CancelTimer(TimerOperation &op) noexcept {
+    return timers_.Cancel(op);
+  }
+
+  /**
+   *  May be called from any thread. The timer is added on the polling thread
+   *  during the next poll, until then it is not pending and cannot be
+   *  cancelled. If memory runs out at that point, the timer fires early
+   */
+  void SubmitTimer(TimerOperation &op, Clock::time_point const deadline)
+      noexcept {
+    op.deadline_ = deadline;
+
+    auto head = incoming_timers_.load(::std::memory_order_relaxed);
+    do {
+      op.next_ = head;
+    } while (!incoming_timers_.compare_exchange_weak(
+        head, &op, ::std::memory_order_release, ::std::memory_order_relaxed));
+
+    if (!head) {
+      // The first timer in the stack wakes up the polling thread
+      ::std::uint64_t one = 1;
+      [[maybe_unused]] auto const res = ::write(wakeup_fd_, &one, sizeof(one));
+    }
+  }
+
   /* non-throwing fd management */
 
   [[nodiscard]] ::std::error_code AddFd(int fd, ::std::uint32_t events,
@@ -165,6 +267,85 @@ class Reactor {
   }
 
  private:
+  [[nodiscard]] bool IsStopRequested() const noexcept {
+    return stop_requested_.load(::std::memory_order_relaxed);
+  }
+
+  // run_tasks returns true if there are still pending tasks
+  template <typename RunTasks>
+  void RunImpl(RunTasks run_tasks) noexcept {
+    auto const spin = busy_poll_;
+    auto const hybrid = (spin != Clock::duration::zero());
+    auto spin_until = hybrid ? Clock::now() + spin : Clock::time_point();
+
+    while (!IsStopRequested()) {
+      if (run_tasks()) {
+        // Do not block while there is work to do
+        Poll(false);
+      } else if (hybrid && Clock::now() < spin_until) {
+        if (Poll(false) == 0) {
+          ::util::single_writer_increment(empty_polls_);
+          continue;
+        }
+      } else {
+        ::util::single_writer_increment(blocking_polls_);
+        Poll(true);
+      }
+
+      if (hybrid) {
+        // There was some activity, so restart spinning
+        spin_until = Clock::now() + spin;
+      }
+    }
+  }
+
+  void TakeIncomingTimers() noexcept {
+    if (!incoming_timers_.load(::std::memory_order_relaxed)) [[likely]] {
+      return;
+    }
+
+    auto op = incoming_timers_.exchange(nullptr, ::std::memory_order_acquire);
+    while (op) {
+      auto const next = ::std::exchange(op->next_, nullptr);
+      try {
+        timers_.Add(*op, op->deadline_);
+      } catch (::std::bad_alloc const &) {
+        op->OnTimer();
+      }
+      op = next;
+    }
+  }
+
+  // Returns the number of handled events and fired timers
+  ::std::size_t Poll(bool const block) noexcept {
+    TakeIncomingTimers();
+
+    if (timers_.IsEmpty()) [[likely]] {
+      return static_cast<::std::size_t>(
+          DoPollOnce(max_events_, block ? -1 : 0));
+    }
+
+    auto const timeout = block ? ToTimeout(timers_.NextDeadline()) : 0;
+    auto const events = static_cast<::std::size_t>(
+        DoPollOnce(max_events_, timeout));
+    return events + timers_.FireExpired(Clock::now());
+  }
+
+  // epoll_wait timeout in milliseconds, rounded up to not wake up too early
+  [[nodiscard]] static int ToTimeout(Clock::time_point const deadline)
+      noexcept {
+    using Ms = ::std::chrono::milliseconds;
+
+    auto const now = Clock::now();
+    if (deadline <= now) {
+      return 0;
+    }
+
+    auto const ms = ::std::chrono::ceil<Ms>(deadline - now).count();
+    return static_cast<int>(
+        ::std::min<Ms::rep>(ms, ::std::numeric_limits<int>::max()));
+  }
+
   // Pre: max_events <= kMaxEventsHard
   int DoPollOnce(int maxevents, int timeout) noexcept {
     epoll_event events[kMaxEventsHard];
@@ -0,0 +1,176 @@
+//
+// registration.hpp
+// ~~~~~~~~~~~~~~~~
+//
+// Copyright (C) 2026 Artyom Kolpakov <ddvamp007@gmail.com>
+//
+// Licensed under GNU GPL-3.0-or-later.
+// See file LICENSE or <https://www.gnu.org/licenses/> for details.
+//
+
+#ifndef DDVAMP_EXE_RUNTIME_REGISTRATION_HPP_INCLUDED_
+#define DDVAMP_EXE_RUNTIME_REGISTRATION_HPP_INCLUDED_ 1
+
+#include <exe/runtime/reactor.hpp>
+
+#include <util/debug/assert.hpp>
+
+#include <sys/epoll.h>
+
+#include <cstdint>
+#include <system_error>
+#include <utility>
+
+namespace exe::runtime {
+
+/**
+ *  Registration of fd in reactor that tracks the interest (EPOLLIN,
+ *  EPOLLOUT, ...) and issues epoll_ctl only when it is really needed
+ *
+ *  kEdge: edge-triggered, the fd is modified only when the interest changes
+ *  kOneShot: the fd is disarmed after each event, so that it is dispatched
+ *    to one thread at a time. Interest changes made in OnReady are
+ *    coalesced, and the fd is rearmed once after OnReady returns, only if
+ *    there is still an interest
+ *
+ *  Interest may be changed in OnReady or while no event can be dispatched
+ *  (e.g. before the first SetInterest or while one-shot is disarmed)
+ *
+ *  If the update deferred after OnReady fails, the fd could be left
+ *  disarmed with nobody to notice it, so OnReady is called once more with
+ *  EPOLLERR. The error is returned by SetInterest called from that OnReady
+ *  or, if there is no such call, by the next one
+ */
+class Registration : private Operation {
+ public:
+  enum class Mode : bool { kEdge, kOneShot };
+
+ private:
+  Reactor &reactor_;
+  int const fd_;
+  Mode const mode_;
+
+  ::std::uint32_t interest_ = 0; // Desired
+  ::std::uint32_t applied_ = 0;  // Flags passed to the kernel last time
+  bool added_ = false;
+  bool armed_ = false;
+  bool dispatching_ = false;
+  ::std::error_code error_; // Of the deferred update
+
+ protected:
+  ~Registration() = default;
+
+ public:
+  Registration(Registration const &) = delete;
+  void operator= (Registration const &) = delete;
+
+  Registration(Registration &&) = delete;
+  void operator= (Registration &&) = delete;
+
+ public:
+  Registration(Reactor &reactor, int const fd, Mode const mode) noexcept
+      : reactor_(reactor)
+      , fd_(fd)
+      , mode_(mode) {}
+
+  // The registration must not be destroyed here
+  virtual void OnReady(::std::uint32_t events) noexcept = 0;
+
+  [[nodiscard]] int GetFd() const noexcept {
+    return fd_;
+  }
+
+  [[nodiscard]] ::std::uint32_t GetInterest() const noexcept {
+    return interest_;
+  }
+
+  /**
+   *  Called in OnReady, the change is applied after it returns. Otherwise,
+   *  it is applied immediately. Returns an error of this or of the last
+   *  deferred update
+   */
+  [[nodiscard]] ::std::error_code SetInterest(::std::uint32_t const events)
+      noexcept {
+    interest_ = events;
+    if (!dispatching_) {
+      Sync();
+    }
+    return ::std::exchange(error_, {});
+  }
+
+  [[nodiscard]] ::std::error_code AddInterest(::std::uint32_t const events)
+      noexcept {
+    return SetInterest(interest_ | events);
+  }
+
+  [[nodiscard]] ::std::error_code RemoveInterest(::std::uint32_t const events)
+      noexcept {
+    return SetInterest(interest_ & ~events);
+  }
+
+  // Removes the fd from reactor, it must be done before the fd is closed
+  // if the fd is shared with another process
+  [[nodiscard]] ::std::error_code Deregister() noexcept {
+    UTIL_ASSERT(!dispatching_, "Deregister in OnReady");
+    interest_ = applied_ = 0;
+    armed_ = false;
+    if (!::std::exchange(added_, false)) {
+      return {};
+    }
+    return reactor_.DelFd(fd_);
+  }
+
+ private:
+  [[nodiscard]] ::std::uint32_t ModeFlags() const noexcept {
+    return mode_ == Mode::kEdge ? EPOLLET : EPOLLONESHOT;
+  }
+
+  void Sync() noexcept {
+    if (mode_ == Mode::kOneShot && interest_ == 0 && !armed_) {
+      // Already disarmed, no need to say the same
+      return;
+    }
+
+    auto const flags = interest_ | ModeFlags();
+    auto const rearm = (mode_ == Mode::kOneShot && !armed_);
+    if (added_ && flags == applied_ && !rearm) [[likely]] {
+      return;
+    }
+
+    auto const ec = added_ ? reactor_.ModFd(fd_, flags, *this)
+                           : reactor_.AddFd(fd_, flags, *this);
+    if (ec) [[unlikely]] {
+      error_ = ec;
+      return;
+    }
+
+    added_ = true;
+    applied_ = flags;
+    armed_ = (interest_ != 0);
+  }
+
+  // Operation
+  void OnEvent(::std::uint32_t const events) noexcept override {
+    if (mode_ == Mode::kOneShot) {
+      armed_ = false;
+    }
+
+    Dispatch(events);
+    Sync();
+
+    if (error_) [[unlikely]] {
+      Dispatch(EPOLLERR);
+      Sync();
+    }
+  }
+
+  void Dispatch(::std::uint32_t const events) noexcept {
+    dispatching_ = true;
+    OnReady(events);
+    dispatching_ = false;
+  }
+};
+
+} // namespace exe::runtime
+
+#endif /* DDVAMP_EXE_RUNTIME_REGISTRATION_HPP_INCLUDED_ */
@@ -2,7 +2,7 @@
 // safe_scheduler.hpp
 // ~~~~~~~~~~~~~~~~~~
 //
-// Copyright (C) 2023-2025 Artyom Kolpakov <ddvamp007@gmail.com>
+// Copyright (C) 2023-2026 Artyom Kolpakov <ddvamp007@gmail.com>
 //
 // Licensed under GNU GPL-3.0-or-later.
 // See file LICENSE or <https://www.gnu.org/licenses/> for details.
@@ -11,6 +11,7 @@
 #ifndef DDVAMP_EXE_RUNTIME_SAFE_SCHEDULER_HPP_INCLUDED_
 #define DDVAMP_EXE_RUNTIME_SAFE_SCHEDULER_HPP_INCLUDED_ 1
 
+#include <exe/runtime/task/priority.hpp>
 #include <exe/runtime/task/scheduler.hpp>
 #include <exe/runtime/task/task.hpp>
 
@@ -45,6 +46,37 @@ class SafeScheduler final : public task::ISafeScheduler {
   } catch (...) {
     UTIL_ABORT("An exception was thrown when scheduling the task");
   }
+
+  void SubmitWithPriority(task::TaskBase *task,
+                          task::Priority const priority) noexcept override try {
+    if constexpr (::std::is_abstract_v<S>) {
+      underlying_.SubmitWithPriority(task, priority);
+    } else {
+      underlying_.S::SubmitWithPriority(task, priority);
+    }
+  } catch (...) {
+    UTIL_ABORT("An exception was thrown when scheduling the task");
+  }
+
+  void SubmitLocal(task::TaskBase *task) noexcept override try {
+    if constexpr (::std::is_abstract_v<S>) {
+      underlying_.SubmitLocal(task);
+    } else {
+      underlying_.S::SubmitLocal(task);
+    }
+  } catch (...) {
+    UTIL_ABORT("An exception was thrown when scheduling the task");
+  }
+
+  void SubmitBatch(task::TaskBase *head) noexcept override try {
+    if constexpr (::std::is_abstract_v<S>) {
+      underlying_.SubmitBatch(head);
+    } else {
+      underlying_.S::SubmitBatch(head);
+    }
+  } catch (...) {
+    UTIL_ABORT("An exception was thrown when scheduling the tasks");
+  }
 };
 
 } // namespace exe::runtime
@@ -0,0 +1,190 @@
+//
+// signal.hpp
+// ~~~~~~~~~~
+//
+// Copyright (C) 2026 Artyom Kolpakov <ddvamp007@gmail.com>
+//
+// Licensed under GNU GPL-3.0-or-later.
+// See file LICENSE or <https://www.gnu.org/licenses/> for details.
+//
+
+#ifndef DDVAMP_EXE_RUNTIME_SIGNAL_HPP_INCLUDED_
+#define DDVAMP_EXE_RUNTIME_SIGNAL_HPP_INCLUDED_ 1
+
+#include <exe/runtime/reactor.hpp>
+
+#include <pthread.h>
+#include <signal.h>
+#include <unistd.h> // close, read, syscall
+#include <sys/epoll.h>
+#include <sys/signalfd.h>
+#include <sys/syscall.h>
+#include <sys/types.h>
+#include <sys/wait.h>
+
+#include <cerrno>
+#include <cstdint>
+#include <initializer_list>
+#include <system_error>
+#include <utility>
+
+namespace exe::runtime {
+
+/**
+ *  Delivers signals as reactor events through signalfd. The signals are
+ *  blocked in the calling thread, so Init should be called before other
+ *  threads are started (they inherit the mask), otherwise the signals
+ *  may still be delivered to them in the usual way
+ */
+class SignalOperation : private Operation {
+ private:
+  int signal_fd_ = -1;
+
+ protected:
+  ~SignalOperation() {
+    Close();
+  }
+
+ public:
+  SignalOperation(SignalOperation const &) = delete;
+  void operator= (SignalOperation const &) = delete;
+
+  SignalOperation(SignalOperation &&) = delete;
+  void operator= (SignalOperation &&) = delete;
+
+ public:
+  SignalOperation() noexcept = default;
+
+  // Called on the reactor thread for each received signal
+  virtual void OnSignal(::signalfd_siginfo const &info) noexcept = 0;
+
+  // Throws: std::system_error
+  void Init(Reactor &reactor, ::std::initializer_list<int> const signals) {
+    ::sigset_t mask;
+    ::sigemptyset(&mask);
+    for (auto const signo : signals) {
+      if (::sigaddset(&mask, signo) == -1) [[unlikely]] {
+        ThrowErrno();
+      }
+    }
+
+    ::sigset_t old_mask;
+    if (auto const err = ::pthread_sigmask(SIG_BLOCK, &mask, &old_mask))
+        [[unlikely]] {
+      ThrowErrorCode({err, ::std::generic_category()});
+    }
+
+    // Otherwise, the signals would stay blocked and be lost
+    auto const fail = [&old_mask](::std::error_code const ec) {
+      ::pthread_sigmask(SIG_SETMASK, &old_mask, nullptr);
+      ThrowErrorCode(ec);
+    };
+
+    signal_fd_ = ::signalfd(-1, &mask, SFD_NONBLOCK | SFD_CLOEXEC);
+    if (signal_fd_ == -1) [[unlikely]] {
+      fail(ErrnoToErrorCode());
+    }
+
+    if (auto const ec = reactor.AddFd(signal_fd_, EPOLLIN, *this))
+        [[unlikely]] {
+      Close();
+      fail(ec);
+    }
+  }
+
+  // The signals stay blocked
+  void Close() noexcept {
+    if (signal_fd_ != -1) {
+      ::close(::std::exchange(signal_fd_, -1));
+    }
+  }
+
+ private:
+  // Operation
+  void OnEvent(::std::uint32_t) noexcept override {
+    ::signalfd_siginfo info;
+    while (::read(signal_fd_, &info, sizeof(info)) == sizeof(info)) {
+      OnSignal(info);
+      if (signal_fd_ == -1) {
+        // Closed by the callback
+        return;
+      }
+    }
+  }
+};
+
+/**
+ *  Reports the exit of a child process through pidfd and reaps it.
+ *  The operation is one-shot: the pidfd is closed after OnExit
+ */
+class ProcessExitOperation : private Operation {
+ private:
+  int pid_fd_ = -1;
+
+ protected:
+  ~ProcessExitOperation() {
+    Close();
+  }
+
+ public:
+  ProcessExitOperation(ProcessExitOperation const &) = delete;
+  void operator= (ProcessExitOperation const &) = delete;
+
+  ProcessExitOperation(ProcessExitOperation &&) = delete;
+  void operator= (ProcessExitOperation &&) = delete;
+
+ public:
+  ProcessExitOperation() noexcept = default;
+
+  /**
+   *  Called on the reactor thread, info.si_code and info.si_status
+   *  describe the exit as for waitid. If waitid fails (e.g. ECHILD, the child
+   *  was reaped elsewhere), error is set to its errno and info is zero-filled
+   */
+  virtual void OnExit(::siginfo_t const &info,
+                      ::std::error_code error) noexcept = 0;
+
+  // Throws: std::system_error
+  void Init(Reactor &reactor, ::pid_t const pid) {
+    pid_fd_ = static_cast<int>(::syscall(SYS_pidfd_open, pid, 0));
+    if (pid_fd_ == -1) [[unlikely]] {
+      ThrowErrno();
+    }
+
+    if (auto const ec = reactor.AddFd(pid_fd_, EPOLLIN, *this)) [[unlikely]] {
+      Close();
+      ThrowErrorCode(ec);
+    }
+  }
+
+  // The process is not reaped if it has not exited yet
+  void Close() noexcept {
+    if (pid_fd_ != -1) {
+      ::close(::std::exchange(pid_fd_, -1));
+    }
+  }
+
+ private:
+  // Operation
+  void OnEvent(::std::uint32_t) noexcept override {
+    ::siginfo_t info = {};
+    auto const res = ::waitid(static_cast<::idtype_t>(P_PIDFD),
+                              static_cast<::id_t>(pid_fd_), &info,
+                              WEXITED | WNOHANG);
+
+    ::std::error_code error;
+    if (res == -1) [[unlikely]] {
+      error = ErrnoToErrorCode();
+    } else if (info.si_pid == 0) [[unlikely]] {
+      // Not exited yet
+      return;
+    }
+
+    Close();
+    OnExit(info, error);
+  }
+};
+
+} // namespace exe::runtime
+
+#endif /* DDVAMP_EXE_RUNTIME_SIGNAL_HPP_INCLUDED_ */
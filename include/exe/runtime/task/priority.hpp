@@ -0,0 +1,30 @@
+//
+// priority.hpp
+// ~~~~~~~~~~~~
+//
+// Copyright (C) 2026 Artyom Kolpakov <ddvamp007@gmail.com>
+//
+// Licensed under GNU GPL-3.0-or-later.
+// See file LICENSE or <https://www.gnu.org/licenses/> for details.
+//
+
+#ifndef DDVAMP_EXE_RUNTIME_TASK_PRIORITY_HPP_INCLUDED_
+#define DDVAMP_EXE_RUNTIME_TASK_PRIORITY_HPP_INCLUDED_ 1
+
+#include <cstddef>
+#include <cstdint>
+
+namespace exe::runtime::task {
+
+// Higher priority tasks are run first by priority-capable schedulers
+enum class Priority : ::std::uint8_t {
+  kHigh,
+  kNormal,
+  kLow,
+};
+
+inline constexpr ::std::size_t kPriorityLevels = 3;
+
+} // namespace exe::runtime::task
+
+#endif /* DDVAMP_EXE_RUNTIME_TASK_PRIORITY_HPP_INCLUDED_ */
@@ -2,7 +2,7 @@
 // scheduler.hpp
 // ~~~~~~~~~~~~~
 //
-// Copyright (C) 2023-2025 Artyom Kolpakov <ddvamp007@gmail.com>
+// Copyright (C) 2023-2026 Artyom Kolpakov <ddvamp007@gmail.com>
 //
 // Licensed under GNU GPL-3.0-or-later.
 // See file LICENSE or <https://www.gnu.org/licenses/> for details.
@@ -11,6 +11,7 @@
 #ifndef DDVAMP_EXE_RUNTIME_TASK_SCHEDULER_HPP_INCLUDED_
 #define DDVAMP_EXE_RUNTIME_TASK_SCHEDULER_HPP_INCLUDED_ 1
 
+#include <exe/runtime/task/priority.hpp>
 #include <exe/runtime/task/task.hpp>
 
 #include <concepts>
@@ -24,6 +25,30 @@ struct IScheduler {
 
  public:
   virtual void Submit(TaskBase *) = 0;
+
+  // Schedulers without priorities ignore the hint
+  virtual void SubmitWithPriority(TaskBase *task, Priority) {
+    Submit(task);
+  }
+
+  // Hint that the task would rather stay on the current worker thread,
+  // e.g. a yielding fiber. Schedulers without such workers ignore it
+  virtual void SubmitLocal(TaskBase *task) {
+    Submit(task);
+  }
+
+  /**
+   *  Submit a nullptr-terminated chain of tasks linked via Link. By default,
+   *  tasks are submitted one by one, so if Submit throws, the rest of the
+   *  chain stays with the caller
+   */
+  virtual void SubmitBatch(TaskBase *head) {
+    while (head) {
+      auto const next = head->Next();
+      Submit(head);
+      head = next;
+    }
+  }
 };
 
 /* Safe means nothrow task scheduling */
@@ -34,6 +59,22 @@ struct ISafeScheduler : IScheduler {
 
  public:
   void Submit(TaskBase *) noexcept override = 0;
+
+  void SubmitWithPriority(TaskBase *task, Priority) noexcept override {
+    Submit(task);
+  }
+
+  void SubmitLocal(TaskBase *task) noexcept override {
+    Submit(task);
+  }
+
+  void SubmitBatch(TaskBase *head) noexcept override {
+    while (head) {
+      auto const next = head->Next();
+      Submit(head);
+      head = next;
+    }
+  }
 };
 
 ////////////////////////////////////////////////////////////////////////////////
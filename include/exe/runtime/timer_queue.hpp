@@ -0,0 +1,201 @@
+//
+// timer_queue.hpp
+// ~~~~~~~~~~~~~~~
+//
+// Copyright (C) 2026 Artyom Kolpakov <ddvamp007@gmail.com>
+//
+// Licensed under GNU GPL-3.0-or-later.
+// See file LICENSE or <https://www.gnu.org/licenses/> for details.
+//
+
+#ifndef DDVAMP_EXE_RUNTIME_TIMER_QUEUE_HPP_INCLUDED_
+#define DDVAMP_EXE_RUNTIME_TIMER_QUEUE_HPP_INCLUDED_ 1
+
+#include <util/debug/assert.hpp>
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+namespace exe::runtime {
+
+class Reactor;
+class TimerQueue;
+
+struct TimerOperation {
+  friend class Reactor;
+  friend class TimerQueue;
+
+ public:
+  using Clock = ::std::chrono::steady_clock;
+
+ private:
+  inline static constexpr ::std::size_t kNotQueued = -1;
+
+  Clock::time_point deadline_;
+  ::std::size_t index_ = kNotQueued;
+  // Order of addition, to tell timers added while firing
+  ::std::uint64_t seq_ = 0;
+  // Link in the inbox of Reactor
+  TimerOperation *next_ = nullptr;
+
+ protected:
+  ~TimerOperation() {
+    UTIL_ASSERT(!IsPending(), "TimerOperation is destroyed while pending");
+  }
+
+ public:
+  virtual void OnTimer() noexcept = 0;
+
+  [[nodiscard]] bool IsPending() const noexcept {
+    return index_ != kNotQueued;
+  }
+
+  [[nodiscard]] Clock::time_point GetDeadline() const noexcept {
+    return deadline_;
+  }
+};
+
+/* Binary min-heap of timers ordered by deadline. Not thread-safe */
+class TimerQueue {
+ public:
+  using Clock = TimerOperation::Clock;
+
+ private:
+  ::std::vector<TimerOperation *> heap_;
+  ::std::uint64_t next_seq_ = 0;
+
+ public:
+  ~TimerQueue() = default;
+
+  TimerQueue(TimerQueue const &) = delete;
+  void operator= (TimerQueue const &) = delete;
+
+  TimerQueue(TimerQueue &&) = delete;
+  void operator= (TimerQueue &&) = delete;
+
+ public:
+  TimerQueue() = default;
+
+  [[nodiscard]] bool IsEmpty() const noexcept {
+    return heap_.empty();
+  }
+
+  [[nodiscard]] ::std::size_t Size() const noexcept {
+    return heap_.size();
+  }
+
+  // Precondition: !IsEmpty()
+  [[nodiscard]] Clock::time_point NextDeadline() const noexcept {
+    UTIL_ASSERT(!IsEmpty(), "TimerQueue is empty");
+    return heap_.front()->deadline_;
+  }
+
+  // Throws: std::bad_alloc
+  void Add(TimerOperation &op, Clock::time_point const deadline) {
+    UTIL_ASSERT(!op.IsPending(), "Timer is already pending");
+    heap_.push_back(&op);
+    op.deadline_ = deadline;
+    op.seq_ = next_seq_++;
+    op.index_ = heap_.size() - 1;
+    SiftUp(op.index_);
+  }
+
+  // Returns false if the timer is not pending (already fired or cancelled)
+  bool Cancel(TimerOperation &op) noexcept {
+    if (!op.IsPending()) {
+      return false;
+    }
+
+    UTIL_ASSERT(op.index_ < heap_.size() && heap_[op.index_] == &op,
+                "Timer belongs to another TimerQueue");
+    RemoveAt(op.index_);
+    return true;
+  }
+
+  /**
+   *  Fires timers whose deadline is not after now, and returns their number.
+   *  Timers can be added and cancelled from OnTimer. A timer that is added
+   *  from OnTimer fires no earlier than the next call, even if its deadline
+   *  has already expired, so a timer that re-adds itself cannot spin forever
+   */
+  ::std::size_t FireExpired(Clock::time_point const now) noexcept {
+    auto const added_before = next_seq_;
+    ::std::size_t fired = 0;
+    while (!IsEmpty() && heap_.front()->deadline_ <= now &&
+           heap_.front()->seq_ < added_before) {
+      auto &op = *heap_.front();
+      RemoveAt(0);
+      op.OnTimer();
+      ++fired;
+    }
+    return fired;
+  }
+
+ private:
+  [[nodiscard]] bool Less(::std::size_t const lhs,
+                          ::std::size_t const rhs) const noexcept {
+    return heap_[lhs]->deadline_ < heap_[rhs]->deadline_;
+  }
+
+  void Swap(::std::size_t const lhs, ::std::size_t const rhs) noexcept {
+    ::std::swap(heap_[lhs], heap_[rhs]);
+    heap_[lhs]->index_ = lhs;
+    heap_[rhs]->index_ = rhs;
+  }
+
+  void SiftUp(::std::size_t idx) noexcept {
+    while (idx != 0) {
+      auto const parent = (idx - 1) / 2;
+      if (!Less(idx, parent)) {
+        return;
+      }
+
+      Swap(idx, parent);
+      idx = parent;
+    }
+  }
+
+  void SiftDown(::std::size_t idx) noexcept {
+    auto const size = heap_.size();
+    while (true) {
+      auto min = idx;
+      auto const left = 2 * idx + 1;
+      auto const right = left + 1;
+
+      if (left < size && Less(left, min)) {
+        min = left;
+      }
+      if (right < size && Less(right, min)) {
+        min = right;
+      }
+      if (min == idx) {
+        return;
+      }
+
+      Swap(idx, min);
+      idx = min;
+    }
+  }
+
+  void RemoveAt(::std::size_t const idx) noexcept {
+    heap_[idx]->index_ = TimerOperation::kNotQueued;
+
+    auto const last = heap_.back();
+    heap_.pop_back();
+    if (idx == heap_.size()) {
+      return;
+    }
+
+    heap_[idx] = last;
+    last->index_ = idx;
+    SiftDown(idx);
+    SiftUp(idx);
+  }
+};
+
+} // namespace exe::runtime
+
+#endif /* DDVAMP_EXE_RUNTIME_TIMER_QUEUE_HPP_INCLUDED_ */
@@ -2,7 +2,7 @@
 // queue.hpp
 // ~~~~~~~~~
 //
-// Copyright (C) 2023-2025 Artyom Kolpakov <ddvamp007@gmail.com>
+// Copyright (C) 2023-2026 Artyom Kolpakov <ddvamp007@gmail.com>
 //
 // Licensed under GNU GPL-3.0-or-later.
 // See file LICENSE or <https://www.gnu.org/licenses/> for details.
@@ -11,6 +11,7 @@
 #ifndef DDVAMP_EXE_RUNTIME_TP_QUEUE_HPP_INCLUDED_
 #define DDVAMP_EXE_RUNTIME_TP_QUEUE_HPP_INCLUDED_ 1
 
+#include <exe/runtime/task/priority.hpp>
 #include <exe/runtime/task/task.hpp>
 
 #include <util/abort.hpp>
@@ -18,19 +19,35 @@
 #include <util/debug/assert.hpp>
 #include <util/intrusive/queue.hpp>
 
+#include <algorithm>
+#include <array>
+#include <atomic>
 #include <condition_variable>
+#include <cstddef>
 #include <cstdint> // std::uint32_t
 #include <mutex>
 
 namespace exe::runtime::tp {
 
+/**
+ *  Tasks of higher priority are popped first. To prevent starvation,
+ *  every kFairnessPeriod-th pop is given to one of the levels below the
+ *  highest non-empty one. These levels take turns, so that each of them
+ *  gets its share while higher levels are busy
+ */
 class Queue {
  private:
-  ::util::intrusive_queue<task::TaskBase> tasks_;
+  inline static constexpr ::std::uint32_t kFairnessPeriod = 64;
+
+  ::std::array<::util::intrusive_queue<task::TaskBase>, task::kPriorityLevels>
+      tasks_;
   ::std::mutex m_;
   ::std::condition_variable has_elements_;
   ::std::uint32_t waiters_count_ = 0;
+  ::std::uint32_t pops_count_ = 0;
+  ::std::uint32_t fair_turns_ = 0;
   bool is_closed_ = false;
+  ::std::atomic_bool has_tasks_ = false; // Written under the lock
 
  public:
   ~Queue() {
@@ -47,12 +64,14 @@ class Queue {
   Queue() = default;
 
   // If Queue is closed, the behavior is undefined
-  void Push(task::TaskBase &task) {
+  void Push(task::TaskBase &task,
+            task::Priority const priority = task::Priority::kNormal) {
     bool waiters;
 
     {
       ::std::lock_guard lock(m_);
-      tasks_.push(task);
+      Level(priority).push(task);
+      has_tasks_.store(true, ::std::memory_order_relaxed);
       waiters = (waiters_count_ != 0);
     }
 
@@ -61,14 +80,44 @@ class Queue {
     }
   }
 
+  // Moves count tasks of batch under one lock acquisition.
+  // If Queue is closed, the behavior is undefined
+  void PushBatch(::util::intrusive_queue<task::TaskBase> &batch,
+                 ::std::size_t const count,
+                 task::Priority const priority = task::Priority::kNormal) {
+    ::std::size_t wake;
+
+    {
+      ::std::lock_guard lock(m_);
+      Level(priority).splice(batch);
+      has_tasks_.store(true, ::std::memory_order_relaxed);
+      wake = ::std::min<::std::size_t>(count, waiters_count_);
+    }
+
+    for (; wake != 0; --wake) {
+      has_elements_.notify_one();
+    }
+  }
+
+  // Lock-free, may be stale
+  [[nodiscard]] bool HasTasksHint() const noexcept {
+    return has_tasks_.load(::std::memory_order_relaxed);
+  }
+
+  // Does not block, nullptr if Queue is empty
+  [[nodiscard]] task::TaskBase *TryPop() {
+    ::std::lock_guard lock(m_);
+    return TryPopLocked();
+  }
+
   [[nodiscard]] task::TaskBase *Pop() {
     ::std::unique_lock lock(m_);
 
     ::util::defer stop_waiting([&cnt = ++waiters_count_] noexcept { --cnt; });
 
     while (true) {
-      if (!tasks_.empty()) [[likely]] {
-        return &tasks_.pop();
+      if (auto const task = TryPopLocked()) [[likely]] {
+        return task;
       }
 
       if (is_closed_) [[unlikely]] {
@@ -93,6 +142,48 @@ class Queue {
 
     has_elements_.notify_all();
   }
+
+ private:
+  [[nodiscard]] ::util::intrusive_queue<task::TaskBase> &Level(
+      task::Priority const priority) noexcept {
+    return tasks_[static_cast<::std::size_t>(priority)];
+  }
+
+  [[nodiscard]] task::TaskBase *TryPopLocked() noexcept {
+    auto const task = TryPopLevelLocked();
+    if (task) [[likely]] {
+      has_tasks_.store(
+          ::std::ranges::any_of(tasks_, [](auto &level) {
+            return !level.empty();
+          }),
+          ::std::memory_order_relaxed);
+    }
+    return task;
+  }
+
+  [[nodiscard]] task::TaskBase *TryPopLevelLocked() noexcept {
+    auto const top = ::std::ranges::find_if(tasks_, [](auto &level) {
+      return !level.empty();
+    });
+    if (top == tasks_.end()) {
+      return nullptr;
+    }
+
+    if (++pops_count_ % kFairnessPeriod == 0) [[unlikely]] {
+      auto const first =
+          static_cast<::std::size_t>(top - tasks_.begin()) + 1;
+      auto const below = tasks_.size() - first;
+      auto const turn = fair_turns_++;
+      for (auto step = 0uz; step != below; ++step) {
+        auto &level = tasks_[first + (turn + step) % below];
+        if (!level.empty()) {
+          return &level.pop();
+        }
+      }
+    }
+
+    return &top->pop();
+  }
 };
 
 } // namespace exe::runtime::tp
@@ -2,7 +2,7 @@
 // thread_pool.hpp
 // ~~~~~~~~~~~~~~~
 //
-// Copyright (C) 2023-2025 Artyom Kolpakov <ddvamp007@gmail.com>
+// Copyright (C) 2023-2026 Artyom Kolpakov <ddvamp007@gmail.com>
 //
 // Licensed under GNU GPL-3.0-or-later.
 // See file LICENSE or <https://www.gnu.org/licenses/> for details.
@@ -11,6 +11,7 @@
 #ifndef DDVAMP_EXE_RUNTIME_TP_THREAD_POOL_HPP_INCLUDED_
 #define DDVAMP_EXE_RUNTIME_TP_THREAD_POOL_HPP_INCLUDED_ 1
 
+#include <exe/runtime/task/priority.hpp>
 #include <exe/runtime/task/scheduler.hpp>
 #include <exe/runtime/task/task.hpp>
 #include <exe/runtime/tp/queue.hpp>
@@ -28,6 +29,11 @@ struct Launch {
 inline constexpr Launch launch{};
 
 
+/**
+ *  Tasks are taken from a shared queue. Besides, each worker has a local
+ *  queue for tasks that prefer to stay on it (SubmitLocal). While both
+ *  queues of a worker have tasks, the worker takes from them in turn
+ */
 class ThreadPool final : public task::IScheduler {
  private:
   enum class State {
@@ -65,12 +71,25 @@ class ThreadPool final : public task::IScheduler {
 
   void Submit(task::TaskBase *task) override;
 
+  void SubmitWithPriority(task::TaskBase *task,
+                          task::Priority priority) override;
+
+  // On a worker thread of this pool, the task is put to the queue of
+  // that worker, which is not shared with other workers
+  void SubmitLocal(task::TaskBase *task) override;
+
+  // The whole chain is enqueued under one lock acquisition
+  void SubmitBatch(task::TaskBase *head) override;
+
   // Wait for all tasks to complete and join threads
   void Stop() noexcept;
 
  private:
   void WorkLoop() noexcept;
 
+  // nullptr when the pool is stopped
+  [[nodiscard]] task::TaskBase *NextTask();
+
   void JoinWorkerThreads();
 };
 
@@ -2,7 +2,7 @@
 // queue.hpp
 // ~~~~~~~~~
 //
-// Copyright (C) 2025 Artyom Kolpakov <ddvamp007@gmail.com>
+// Copyright (C) 2025-2026 Artyom Kolpakov <ddvamp007@gmail.com>
 //
 // Licensed under GNU GPL-3.0-or-later.
 // See file LICENSE or <https://www.gnu.org/licenses/> for details.
@@ -59,6 +59,11 @@ class intrusive_queue {
     }
   }
 
+  [[nodiscard]] constexpr T &front() const noexcept {
+    UTIL_ASSERT(!empty(), "Queue is empty");
+    return *head_;
+  }
+
   [[nodiscard]] constexpr T &pop() noexcept {
     UTIL_ASSERT(!empty(), "Queue is empty");
 
@@ -67,6 +72,21 @@ class intrusive_queue {
     return *ptr;
   }
 
+  // Moves all elements of that to the end
+  constexpr void splice(intrusive_queue &that) noexcept {
+    if (that.empty()) {
+      return;
+    }
+
+    if (empty()) {
+      head_ = that.head_;
+    } else {
+      tail_->link(that.head_);
+    }
+    tail_ = ::std::exchange(that.tail_, nullptr);
+    that.head_ = nullptr;
+  }
+
   constexpr void swap(intrusive_queue &that) noexcept {
     ::std::swap(head_, that.head_);
     ::std::swap(tail_, that.tail_);
@@ -0,0 +1,38 @@
+//
+// single_writer.hpp
+// ~~~~~~~~~~~~~~~~~
+//
+// Copyright (C) 2026 Artyom Kolpakov <ddvamp007@gmail.com>
+//
+// Licensed under GNU GPL-3.0-or-later.
+// See file LICENSE or <https://www.gnu.org/licenses/> for details.
+//
+
+#ifndef DDVAMP_UTIL_MM_SINGLE_WRITER_HPP_INCLUDED_
+#define DDVAMP_UTIL_MM_SINGLE_WRITER_HPP_INCLUDED_ 1
+
+#include <atomic>
+#include <concepts>
+#include <type_traits>
+
+namespace util {
+
+/**
+ *  Adds value to a counter that is modified by only one thread and may be
+ *  read by others. Plain load and store avoid a locked read-modify-write
+ */
+template <::std::integral T>
+inline void single_writer_add(::std::atomic<T> &a,
+                              ::std::type_identity_t<T> const value) noexcept {
+  a.store(a.load(::std::memory_order_relaxed) + value,
+          ::std::memory_order_relaxed);
+}
+
+template <::std::integral T>
+inline void single_writer_increment(::std::atomic<T> &a) noexcept {
+  single_writer_add(a, T{1});
+}
+
+} // namespace util
+
+#endif /* DDVAMP_UTIL_MM_SINGLE_WRITER_HPP_INCLUDED_ */
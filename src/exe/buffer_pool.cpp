@@ -0,0 +1,247 @@
+//
+// buffer_pool.cpp
+// ~~~~~~~~~~~~~~~
+//
+// Copyright (C) 2026 Artyom Kolpakov <ddvamp007@gmail.com>
+//
+// Licensed under GNU GPL-3.0-or-later.
+// See file LICENSE or <https://www.gnu.org/licenses/> for details.
+//
+
+#include <exe/runtime/buffer_pool.hpp>
+
+#include <util/debug/assert.hpp>
+#include <util/memory/page_allocation.hpp>
+#include <util/memory/view.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <limits>
+#include <new>
+#include <utility>
+#include <vector>
+
+namespace exe::runtime {
+
+namespace {
+
+thread_local BufferPool::ThreadCache *caches = nullptr;
+
+[[nodiscard]] ::std::size_t AlignBufferSize(::std::size_t const size) noexcept {
+  constexpr auto kAlign = BufferPool::kBufferAlignment;
+  return (::std::max(size, ::std::size_t{1}) + kAlign - 1) / kAlign * kAlign;
+}
+
+} // namespace
+
+void detail::ReleaseBlock(BufferBlock *const block) noexcept {
+  block->pool->Release(block);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+BufferPool::~BufferPool() {
+  UTIL_ASSERT(cache_count_ == 0, "BufferPool is destroyed before its caches");
+  UTIL_ASSERT(free_count_ == slab_count_ * buffers_per_slab_,
+              "BufferPool is destroyed while buffers are in use");
+}
+
+BufferPool::BufferPool(::std::size_t const buffer_size,
+                       ::std::size_t const buffers_per_slab,
+                       ::std::size_t const max_slabs)
+    : buffer_size_(AlignBufferSize(buffer_size))
+    , buffers_per_slab_(buffers_per_slab)
+    , max_slabs_(max_slabs)
+    , slabs_(::std::make_unique<::util::page_allocation[]>(max_slabs)) {
+  UTIL_ASSERT(buffers_per_slab != 0 && max_slabs != 0, "Empty BufferPool");
+  UTIL_ASSERT(
+      max_slabs <= ::std::numeric_limits<BufferId>::max() / buffers_per_slab,
+      "Too many buffers for BufferId");
+}
+
+Buffer BufferPool::Acquire() {
+  auto buffer = TryAcquire();
+  if (!buffer) [[unlikely]] {
+    throw ::std::bad_alloc();
+  }
+  return buffer;
+}
+
+Buffer BufferPool::TryAcquire() noexcept {
+  auto const cache = FindCache();
+  do {
+    auto const block = cache ? cache->TryTake() : TryTake();
+    if (block) [[likely]] {
+      return MakeBuffer(block, buffer_size_);
+    }
+  } while (Grow());
+
+  return {};
+}
+
+Buffer BufferPool::Attach(BufferId const id) noexcept {
+  auto const block = GetBlock(id);
+  UTIL_ASSERT(block->refs.load(::std::memory_order_relaxed) == 1,
+              "Attaching a buffer that is not detached");
+  return Buffer(block, buffer_size_);
+}
+
+::std::vector<::util::memory_view> BufferPool::GetSlabs() {
+  ::std::vector<::util::memory_view> slabs;
+
+  auto guard = lock_.MakeGuard();
+  slabs.reserve(slab_count_);
+  for (auto idx = 0uz; idx != slab_count_; ++idx) {
+    slabs.emplace_back(slabs_[idx].begin(), buffer_size_ * buffers_per_slab_);
+  }
+
+  return slabs;
+}
+
+BufferPool::Block *BufferPool::TryTake() noexcept {
+  Block *block;
+  return TakeBatch(&block, 1) != 0 ? block : nullptr;
+}
+
+void BufferPool::Put(Block *const block) noexcept {
+  auto blocks = block;
+  PutBatch(&blocks, 1);
+}
+
+void BufferPool::Release(Block *const block) noexcept {
+  if (auto const cache = FindCache()) [[likely]] {
+    cache->Put(block);
+  } else {
+    Put(block);
+  }
+}
+
+::std::size_t BufferPool::TakeBatch(Block **const out,
+                                    ::std::size_t const count) noexcept {
+  auto guard = lock_.MakeGuard();
+  auto const taken = ::std::min(count, free_count_);
+  for (auto idx = 0uz; idx != taken; ++idx) {
+    out[idx] = &free_.pop();
+  }
+  free_count_ -= taken;
+  return taken;
+}
+
+void BufferPool::PutBatch(Block **const blocks,
+                          ::std::size_t const count) noexcept {
+  auto guard = lock_.MakeGuard();
+  for (auto idx = 0uz; idx != count; ++idx) {
+    free_.push(*blocks[idx]);
+  }
+  free_count_ += count;
+}
+
+bool BufferPool::Grow() noexcept {
+  auto const data_bytes = buffer_size_ * buffers_per_slab_;
+
+  // Allocate outside of the lock
+  ::util::page_allocation slab;
+  try {
+    slab = ::util::page_allocation::allocate_pages(
+        ::util::page_allocation::bytes_to_pages(
+            data_bytes + buffers_per_slab_ * sizeof(Block)));
+  } catch (...) {
+    return false;
+  }
+
+  auto guard = lock_.MakeGuard();
+
+  if (slab_count_ == max_slabs_) [[unlikely]] {
+    // Another thread may have added the last slab
+    return free_count_ != 0;
+  }
+
+  auto const slab_idx = slab_count_++;
+  auto const blocks = ::new (slab.begin() + data_bytes)
+                          Block[buffers_per_slab_];
+
+  for (auto idx = 0uz; idx != buffers_per_slab_; ++idx) {
+    auto &block = blocks[idx];
+    block.pool = this;
+    block.data = slab.begin() + idx * buffer_size_;
+    block.id = static_cast<BufferId>(slab_idx * buffers_per_slab_ + idx);
+    free_.push(block);
+  }
+  free_count_ += buffers_per_slab_;
+
+  slabs_[slab_idx] = ::std::move(slab);
+  return true;
+}
+
+BufferPool::ThreadCache *BufferPool::FindCache() const noexcept {
+  for (auto cache = caches; cache; cache = cache->next_) {
+    if (&cache->pool_ == this) [[likely]] {
+      return cache;
+    }
+  }
+  return nullptr;
+}
+
+BufferPool::Block *BufferPool::GetBlock(BufferId const id) const noexcept {
+  auto const slab_idx = id / buffers_per_slab_;
+  auto const idx = id % buffers_per_slab_;
+
+  // The slab happens before any buffer of it was detached
+  auto const blocks = reinterpret_cast<Block *>(
+      slabs_[slab_idx].begin() + buffer_size_ * buffers_per_slab_);
+  return blocks + idx;
+}
+
+/* static */ Buffer BufferPool::MakeBuffer(Block *const block,
+                                           ::std::size_t const size) noexcept {
+  block->refs.store(1, ::std::memory_order_relaxed);
+  return Buffer(block, size);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+BufferPool::ThreadCache::~ThreadCache() {
+  pool_.PutBatch(blocks_.data(), count_);
+
+  auto link = &caches;
+  while (*link != this) {
+    UTIL_ASSERT(*link, "ThreadCache is destroyed on another thread");
+    link = &(*link)->next_;
+  }
+  *link = next_;
+
+  auto guard = pool_.lock_.MakeGuard();
+  --pool_.cache_count_;
+}
+
+BufferPool::ThreadCache::ThreadCache(BufferPool &pool) noexcept
+    : pool_(pool)
+    , next_(caches) {
+  UTIL_ASSERT(!pool.FindCache(), "Thread already has a cache for the pool");
+  caches = this;
+
+  auto guard = pool_.lock_.MakeGuard();
+  ++pool_.cache_count_;
+}
+
+BufferPool::Block *BufferPool::ThreadCache::TryTake() noexcept {
+  if (count_ == 0) [[unlikely]] {
+    count_ = pool_.TakeBatch(blocks_.data(), kBatch);
+    if (count_ == 0) [[unlikely]] {
+      return nullptr;
+    }
+  }
+
+  return blocks_[--count_];
+}
+
+void BufferPool::ThreadCache::Put(Block *const block) noexcept {
+  if (count_ == kCapacity) [[unlikely]] {
+    count_ -= kBatch;
+    pool_.PutBatch(blocks_.data() + count_, kBatch);
+  }
+
+  blocks_[count_++] = block;
+}
+
+} // namespace exe::runtime
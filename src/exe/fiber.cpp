@@ -14,13 +14,26 @@
 #include <exe/fiber/core/fiber.hpp>
 #include <exe/fiber/core/handle.hpp>
 #include <exe/fiber/core/id.hpp>
+#include <exe/fiber/core/local.hpp>
+#include <exe/fiber/core/run_mark.hpp>
 #include <exe/fiber/core/scheduler.hpp>
 #include <exe/fiber/core/stack.hpp>
+#include <exe/fiber/sync/mutex.hpp>
 
+#include <concurrency/qspinlock.hpp>
 #include <util/abort.hpp>
 #include <util/debug.hpp>
+#include <util/memory/view.hpp>
+#include <util/mm/single_writer.hpp>
 
+#include <algorithm>
+#include <array>
 #include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <new> // std::hardware_destructive_interference_size
+#include <span>
+#include <thread>
 #include <utility>
 
 namespace exe::fiber {
@@ -29,6 +42,87 @@ namespace {
 
 thread_local Fiber *current = nullptr;
 
+// Counters of a thread live for the whole process, so that run marks stay
+// readable after the thread exits. Counters freed by an exiting thread are
+// reused by a new one: they keep growing, so the marks of the former owner
+// stay stale, and the sums of the statistics stay correct
+constexpr ::std::size_t kThreadCounters = 1024;
+
+struct alignas (::std::hardware_destructive_interference_size)
+    ThreadCounters {
+  // Fibers that stopped running on the thread (see RunMark)
+  ::std::atomic_uint64_t switches = 0;
+  // See MutexSpinStats
+  ::std::atomic_uint64_t mutex_spin_attempts = 0;
+  ::std::atomic_uint64_t mutex_spin_successes = 0;
+  ThreadCounters *next_free = nullptr;
+};
+
+class ThreadCountersPool {
+ private:
+  ::std::array<ThreadCounters, kThreadCounters> counters_;
+  ::concurrency::QSpinlock lock_; // Protects free_ and used_
+  ThreadCounters *free_ = nullptr;
+  ::std::size_t used_ = 0;
+
+ public:
+  // nullptr if all counters are taken
+  [[nodiscard]] ThreadCounters *Acquire() noexcept {
+    auto guard = lock_.MakeGuard();
+
+    if (free_) {
+      return ::std::exchange(free_, free_->next_free);
+    }
+    return used_ != kThreadCounters ? &counters_[used_++] : nullptr;
+  }
+
+  void Release(ThreadCounters &counters) noexcept {
+    auto guard = lock_.MakeGuard();
+    counters.next_free = ::std::exchange(free_, &counters);
+  }
+
+  [[nodiscard]] ::std::span<ThreadCounters const> GetUsed() noexcept {
+    auto guard = lock_.MakeGuard();
+    return {counters_.data(), used_};
+  }
+};
+
+ThreadCountersPool thread_counters;
+
+// Shared by the threads left without counters, their runs are never marked
+ThreadCounters unmarked_counters;
+
+// Counters of the current thread, acquired by its first fiber
+thread_local ThreadCounters *counters = nullptr;
+
+// Releases the counters of the thread when it exits
+struct ThreadCountersOwner {
+  ThreadCounters *counters = nullptr;
+
+  ~ThreadCountersOwner() {
+    if (counters) {
+      thread_counters.Release(*counters);
+    }
+  }
+};
+
+thread_local ThreadCountersOwner thread_counters_owner;
+
+[[gnu::noinline]] void AcquireThreadCounters() noexcept {
+  auto const acquired = thread_counters.Acquire();
+  thread_counters_owner.counters = acquired;
+  counters = acquired ? acquired : &unmarked_counters;
+}
+
+// Number of fibers created and submitted at once by StartMany
+constexpr ::std::size_t kStartBatch = 64;
+
+// Ids are reserved by threads in blocks, so that the shared counter
+// is touched once per kIdBlock created fibers
+constexpr FiberId kIdBlock = 1024;
+thread_local FiberId next_id = 0;
+thread_local FiberId end_id = 0;
+
 struct ContextGuard {
   Fiber *from;
 
@@ -52,6 +146,13 @@ struct YieldAwaiter final : IAwaiter {
   }
 };
 
+struct YieldLocalAwaiter final : IAwaiter {
+  FiberHandle AwaitSymmetricSuspend(FiberHandle &&self) noexcept override {
+    ::std::move(self).ScheduleLocal();
+    return FiberHandle::Invalid();
+  }
+};
+
 struct SwitchAwaiter final : IAwaiter {
   FiberHandle &target_;
 
@@ -70,7 +171,67 @@ struct SwitchAwaiter final : IAwaiter {
 ////////////////////////////////////////////////////////////////////////////////
 
 /* static */ Fiber *Fiber::Create(Body &&body, Scheduler &scheduler) {
-  return ::new Fiber(::std::move(body), AllocateStack(), scheduler);
+  return Create(::std::move(body), scheduler, GetDefaultStackSize());
+}
+
+/* static */ Fiber *Fiber::Create(Body &&body, Scheduler &scheduler,
+                                  StackSize const stack_size) {
+  auto stack = AllocateStack(stack_size);
+  auto const place = PlaceControlBlock(stack);
+  return ::new (place)
+      Fiber(::std::move(body), ::std::move(stack), scheduler, place);
+}
+
+/* static */ Fiber *Fiber::Create(Body &&body, Scheduler &scheduler,
+                                  StackSize const stack_size,
+                                  Priority const priority) {
+  auto const fiber = Create(::std::move(body), scheduler, stack_size);
+  fiber->priority_ = priority;
+  return fiber;
+}
+
+/* static */ void Fiber::StartMany(Scheduler &scheduler,
+                                   ::std::size_t const count,
+                                   BodyFactory &make_body,
+                                   StackSize const stack_size) {
+  ::std::array<Stack, kStartBatch> stacks;
+
+  for (auto first = 0uz; first < count; first += kStartBatch) {
+    auto const chunk =
+        ::std::span(stacks).first(::std::min(count - first, kStartBatch));
+    AllocateStacks(stack_size, chunk);
+
+    TaskBase *head = nullptr;
+    TaskBase *tail = nullptr;
+
+    for (auto idx = 0uz; idx != chunk.size(); ++idx) {
+      Body body;
+      try {
+        body = make_body(first + idx);
+      } catch (...) {
+        for (auto &stack : chunk.subspan(idx)) {
+          DeallocateStack(::std::move(stack));
+        }
+        scheduler.SubmitBatch(head);
+        throw;
+      }
+      UTIL_ASSERT(body, "Empty body for fiber");
+
+      auto const place = PlaceControlBlock(chunk[idx]);
+      TaskBase *const fiber = ::new (place)
+          Fiber(::std::move(body), ::std::move(chunk[idx]), scheduler, place);
+
+      fiber->Link(nullptr);
+      if (tail) {
+        tail->Link(fiber);
+      } else {
+        head = fiber;
+      }
+      tail = fiber;
+    }
+
+    scheduler.SubmitBatch(head);
+  }
 }
 
 /* static */ Fiber &Fiber::Self() noexcept {
@@ -79,7 +240,29 @@ struct SwitchAwaiter final : IAwaiter {
 }
 
 void Fiber::Schedule() noexcept {
-  scheduler_.get().Submit(this);
+  scheduler_.get().SubmitWithPriority(this, priority_);
+}
+
+void Fiber::ScheduleLocal() noexcept {
+  // Local queues know nothing about priorities
+  if (priority_ == Priority::kNormal) [[likely]] {
+    scheduler_.get().SubmitLocal(this);
+  } else {
+    Schedule();
+  }
+}
+
+void Fiber::Wake() noexcept {
+  // The successor runs on the thread of the waker, so it must share
+  // the scheduler. Only one successor, the rest are scheduled
+  if (auto const waker = current;
+      waker && waker->handoff_ && !waker->successor_ &&
+      &waker->GetScheduler() == &GetScheduler()) [[unlikely]] {
+    waker->successor_ = this;
+    return;
+  }
+
+  Schedule();
 }
 
 void Fiber::Resume() noexcept {
@@ -96,10 +279,38 @@ void Fiber::TeleportTo(Scheduler &scheduler) noexcept {
   self::Yield();
 }
 
-Fiber::Fiber(Body &&body, Stack &&stack, Scheduler &scheduler) noexcept
+Fiber::Fiber(Body &&body, Stack &&stack, Scheduler &scheduler,
+             void *const stack_top, JoinState *const join) noexcept
     : stack_(::std::move(stack))
-    , coroutine_(::std::move(body), stack_.View())
-    , scheduler_(scheduler) {}
+    , join_(join)
+    , coroutine_(::std::move(body), ExecutionStack(stack_top))
+    , scheduler_(scheduler) {
+  if (join_) {
+    join_->fiber_ = this;
+  }
+}
+
+/* static */ void *Fiber::PlaceControlBlock(Stack &stack) noexcept {
+  constexpr auto kAlign = ::std::max(alignof(Fiber), ::std::size_t{64});
+
+  auto const view = stack.View();
+  auto const top =
+      reinterpret_cast<::std::uintptr_t>(view.data() + view.size());
+  return PlaceBelow(reinterpret_cast<void *>(top), sizeof(Fiber), kAlign);
+}
+
+/* static */ void *Fiber::PlaceBelow(void *const place,
+                                     ::std::size_t const size,
+                                     ::std::size_t const align) noexcept {
+  auto const addr = reinterpret_cast<::std::uintptr_t>(place);
+  return reinterpret_cast<void *>((addr - size) & ~(align - 1));
+}
+
+::util::memory_view Fiber::ExecutionStack(void *const top) noexcept {
+  auto const view = stack_.View();
+  return view.first(static_cast<::std::size_t>(
+      static_cast<::std::byte *>(top) - view.data()));
+}
 
 /* virtual */ void Fiber::Run() && noexcept {
   ContextGuard guard(nullptr, current);
@@ -108,18 +319,41 @@ Fiber::Fiber(Body &&body, Stack &&stack, Scheduler &scheduler) noexcept
 }
 
 Fiber *Fiber::DoRun() noexcept {
-  if (auto awaiter = Step()) [[likely]] {
-    return awaiter->AwaitSymmetricSuspend(FiberHandle(*this)).Release();
+  auto const awaiter = Step();
+
+  // Taken before the fiber is released to the awaiter
+  auto const successor = ::std::exchange(successor_, nullptr);
+
+  Fiber *next;
+  if (awaiter) [[likely]] {
+    next = awaiter->AwaitSymmetricSuspend(FiberHandle(*this)).Release();
+  } else {
+    next = Complete();
   }
 
-  DestroySelf();
-  return nullptr;
+  if (!successor) [[likely]] {
+    return next;
+  }
+
+  // An explicit switch target of the awaiter takes precedence
+  if (next) {
+    successor->Schedule();
+    return next;
+  }
+
+  return successor;
 }
 
 IAwaiter *Fiber::Step() noexcept {
   ContextGuard guard(this, nullptr);
 
+  if (!counters) [[unlikely]] {
+    AcquireThreadCounters();
+  }
+
   coroutine_.Resume();
+  // Only this thread writes the counter, except for unmarked_counters
+  ::util::single_writer_increment(counters->switches);
   UTIL_ASSERT(coroutine_.IsCompleted() == !awaiter_,
               "Internal error! Awaiter is either lost or "
               "provided for a completed fiber");
@@ -131,19 +365,115 @@ void Fiber::Stop() noexcept {
   coroutine_.Suspend();
 }
 
-void Fiber::DestroySelf() noexcept {
-  ReleaseResources();
-  delete this;
+Fiber *Fiber::Complete() noexcept {
+  DestroyFiberLocals(locals_);
+
+  if (!join_) [[likely]] {
+    DestroySelf();
+    return nullptr;
+  }
+
+  auto const scheduler = &scheduler_.get();
+  auto const waiter = join_->Complete();
+  if (!waiter) {
+    return nullptr;
+  }
+
+  // Continue with the waiter on this thread if it is on the same scheduler
+  if (&waiter->GetScheduler() == scheduler) [[likely]] {
+    return waiter;
+  }
+
+  waiter->Schedule();
+  return nullptr;
 }
 
-void Fiber::ReleaseResources() noexcept {
-  DeallocateStack(::std::move(stack_));
+void Fiber::DestroySelf() noexcept {
+  if (join_) {
+    join_->~JoinState();
+  }
+
+  // The fiber lives in its own stack
+  auto stack = ::std::move(stack_);
+  this->~Fiber();
+
+  if (IsStackProfilingEnabled()) [[unlikely]] {
+    RecordStackUsage(stack);
+  }
+
+  DeallocateStack(::std::move(stack));
 }
 
 /* static */ FiberId Fiber::GetNextId() noexcept {
-  return next_id_.fetch_add(1, ::std::memory_order_relaxed);
+  if (next_id == end_id) [[unlikely]] {
+    next_id = next_id_.fetch_add(kIdBlock, ::std::memory_order_relaxed);
+    end_id = next_id + kIdBlock;
+  }
+
+  return next_id++;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+class JoinState::Awaiter final : public IAwaiter {
+ private:
+  JoinState &state_;
+
+ public:
+  explicit Awaiter(JoinState &state) noexcept : state_(state) {}
+
+  FiberHandle AwaitSymmetricSuspend(FiberHandle &&self) noexcept override {
+    auto const waiter = self.Release();
+
+    auto expected = kRunning;
+    if (state_.state_.compare_exchange_strong(
+            expected, reinterpret_cast<::std::uintptr_t>(waiter),
+            ::std::memory_order_release, ::std::memory_order_acquire)) {
+      return FiberHandle::Invalid();
+    }
+
+    // Already completed
+    return FiberHandle(*waiter);
+  }
+};
+
+void JoinState::Wait() noexcept {
+  if (state_.load(::std::memory_order_acquire) == kCompleted) {
+    return;
+  }
+
+  Awaiter awaiter(*this);
+  self::Suspend(awaiter);
 }
 
+void JoinState::Destroy() noexcept {
+  UTIL_ASSERT(state_.load(::std::memory_order_relaxed) == kCompleted,
+              "Destroying a running fiber");
+  fiber_->DestroySelf();
+}
+
+void JoinState::Detach() noexcept {
+  auto expected = kRunning;
+  if (!state_.compare_exchange_strong(expected, kDetached,
+                                      ::std::memory_order_acq_rel,
+                                      ::std::memory_order_acquire)) {
+    UTIL_ASSERT(expected == kCompleted, "Detaching a waited fiber");
+    fiber_->DestroySelf();
+  }
+}
+
+Fiber *JoinState::Complete() noexcept {
+  auto const prev = state_.exchange(kCompleted, ::std::memory_order_acq_rel);
+
+  if (prev == kDetached) {
+    fiber_->DestroySelf();
+    return nullptr;
+  }
+
+  return reinterpret_cast<Fiber *>(prev);
+}
+
+
 ////////////////////////////////////////////////////////////////////////////////
 
 /* API */
@@ -158,15 +488,58 @@ Scheduler &GetScheduler() noexcept {
   return Fiber::Self().GetScheduler();
 }
 
+Priority GetPriority() noexcept {
+  return Fiber::Self().GetPriority();
+}
+
+void SetPriority(Priority const priority) noexcept {
+  Fiber::Self().SetPriority(priority);
+}
+
+void SetWakeHandoff(bool const enable) noexcept {
+  Fiber::Self().SetWakeHandoff(enable);
+}
+
+void *&GetLocal(FiberLocalKey const key) noexcept {
+  UTIL_ASSERT(key < kMaxFiberLocals, "Invalid fiber-local key");
+  return Fiber::Self().GetLocal(key);
+}
+
 void Suspend(IAwaiter &awaiter) noexcept {
   Fiber::Self().Suspend(awaiter);
 }
 
+RunMark GetRunMark() noexcept {
+  // Outside of a fiber, there is no run to mark
+  if (!AmIFiber() || counters == &unmarked_counters) [[unlikely]] {
+    return {};
+  }
+
+  return {
+    .switches = &counters->switches,
+    .epoch = counters->switches.load(::std::memory_order_relaxed),
+  };
+}
+
+bool IsRunningElsewhere(RunMark const mark) noexcept {
+  // With a single core, the other thread cannot run meanwhile
+  static bool const multicore = ::std::thread::hardware_concurrency() > 1;
+
+  return multicore && mark.switches &&
+         (!counters || mark.switches != &counters->switches) &&
+         mark.switches->load(::std::memory_order_relaxed) == mark.epoch;
+}
+
 void Yield() noexcept {
   YieldAwaiter awaiter;
   Suspend(awaiter);
 }
 
+void YieldLocal() noexcept {
+  YieldLocalAwaiter awaiter;
+  Suspend(awaiter);
+}
+
 void SwitchTo(FiberHandle &&next) noexcept {
   SwitchAwaiter awaiter(::std::move(next));
   Suspend(awaiter);
@@ -189,6 +562,37 @@ void Go(Body &&body) {
   Go(self::GetScheduler(), ::std::move(body));
 }
 
+void Go(Scheduler &scheduler, Body &&body, StackSize const stack_size) {
+  UTIL_ASSERT(body, "Empty body for fiber");
+  Fiber::Create(::std::move(body), scheduler, stack_size)->Schedule();
+}
+
+void Go(Body &&body, StackSize const stack_size) {
+  Go(self::GetScheduler(), ::std::move(body), stack_size);
+}
+
+void Go(Scheduler &scheduler, Body &&body, Priority const priority) {
+  Go(scheduler, ::std::move(body), GetDefaultStackSize(), priority);
+}
+
+void Go(Scheduler &scheduler, Body &&body, StackSize const stack_size,
+        Priority const priority) {
+  UTIL_ASSERT(body, "Empty body for fiber");
+  Fiber::Create(::std::move(body), scheduler, stack_size, priority)
+      ->Schedule();
+}
+
+void GoMany(Scheduler &scheduler, ::std::size_t const count,
+            BodyFactory make_body) {
+  GoMany(scheduler, count, ::std::move(make_body), GetDefaultStackSize());
+}
+
+void GoMany(Scheduler &scheduler, ::std::size_t const count,
+            BodyFactory make_body, StackSize const stack_size) {
+  UTIL_ASSERT(make_body, "Empty body factory for fibers");
+  Fiber::StartMany(scheduler, count, make_body, stack_size);
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 
 NoSwitchContextGuard::NoSwitchContextGuard() noexcept : self(current) {
@@ -199,4 +603,38 @@ NoSwitchContextGuard::~NoSwitchContextGuard() {
   current = self;
 }
 
+////////////////////////////////////////////////////////////////////////////////
+
+namespace detail {
+
+void CountMutexSpin(bool const acquired) noexcept {
+  // Only this thread writes the counters, except for unmarked_counters
+  if (counters) [[likely]] {
+    ::util::single_writer_increment(counters->mutex_spin_attempts);
+    if (acquired) {
+      ::util::single_writer_increment(counters->mutex_spin_successes);
+    }
+  }
+}
+
+} // namespace detail
+
+MutexSpinStats GetMutexSpinStats() noexcept {
+  MutexSpinStats stats{
+    .attempts =
+        unmarked_counters.mutex_spin_attempts.load(::std::memory_order_relaxed),
+    .successes = unmarked_counters.mutex_spin_successes.load(
+        ::std::memory_order_relaxed),
+  };
+
+  for (auto const &thread : thread_counters.GetUsed()) {
+    stats.attempts +=
+        thread.mutex_spin_attempts.load(::std::memory_order_relaxed);
+    stats.successes +=
+        thread.mutex_spin_successes.load(::std::memory_order_relaxed);
+  }
+
+  return stats;
+}
+
 } // namespace exe::fiber
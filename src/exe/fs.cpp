@@ -0,0 +1,161 @@
+//
+// fs.cpp
+// ~~~~~~
+//
+// Copyright (C) 2026 Artyom Kolpakov <ddvamp007@gmail.com>
+//
+// Licensed under GNU GPL-3.0-or-later.
+// See file LICENSE or <https://www.gnu.org/licenses/> for details.
+//
+
+#include <exe/fiber/api.hpp>
+#include <exe/fiber/core/awaiter.hpp>
+#include <exe/fiber/core/handle.hpp>
+#include <exe/fiber/fs/file.hpp>
+#include <exe/runtime/task/task.hpp>
+#include <exe/runtime/thread_pool.hpp>
+
+#include <unistd.h>
+
+#include <cerrno>
+#include <cstddef>
+#include <span>
+#include <system_error>
+#include <utility>
+
+namespace exe::fiber::fs {
+
+namespace {
+
+// Blocking calls are mostly waiting, so few threads are enough
+constexpr ::std::size_t kIoThreads = 4;
+
+class IoPool {
+ private:
+  runtime::ThreadPool pool_{runtime::tp::launch, kIoThreads};
+
+ public:
+  ~IoPool() {
+    pool_.Stop();
+  }
+
+  [[nodiscard]] static runtime::ThreadPool &Get() noexcept {
+    static IoPool instance;
+    return instance.pool_;
+  }
+};
+
+/**
+ *  Runs op on the I/O pool while the fiber is suspended.
+ *  op returns the result of syscall, -1 means an error in errno
+ */
+template <typename Op>
+class OffloadAwaiter final : public IAwaiter
+                           , private runtime::task::TaskBase {
+ private:
+  Op op_;
+  FiberHandle handle_;
+  ::ssize_t result_ = -1;
+  int error_ = 0;
+
+ public:
+  explicit OffloadAwaiter(Op op) noexcept
+      : op_(::std::move(op)) {}
+
+  [[nodiscard]] Result<::std::size_t, ::std::error_code> GetResult()
+      const noexcept {
+    if (result_ == -1) [[unlikely]] {
+      return result::Err<::std::size_t>(
+          ::std::error_code(error_, ::std::generic_category()));
+    }
+    return result::Ok<::std::size_t, ::std::error_code>(
+        static_cast<::std::size_t>(result_));
+  }
+
+  FiberHandle AwaitSymmetricSuspend(FiberHandle &&self) noexcept override {
+    handle_ = ::std::move(self);
+
+    try {
+      IoPool::Get().Submit(this);
+    } catch (...) {
+      // Do it in place rather than lose the call
+      Execute();
+      return ::std::move(handle_);
+    }
+
+    // From now on, the awaiter may be destroyed at any time
+    return FiberHandle::Invalid();
+  }
+
+ private:
+  void Execute() noexcept {
+    result_ = op_();
+    error_ = (result_ == -1) ? errno : 0;
+  }
+
+  // runtime::task::ITask
+  void Run() && noexcept override {
+    Execute();
+    ::std::move(handle_).Schedule();
+  }
+};
+
+template <typename Op>
+[[nodiscard]] Result<::std::size_t, ::std::error_code> Offload(Op op)
+    noexcept {
+  OffloadAwaiter<Op> awaiter(::std::move(op));
+  self::Suspend(awaiter);
+  return awaiter.GetResult();
+}
+
+} // namespace
+
+Result<::std::size_t, ::std::error_code> Read(
+    int const fd, ::std::span<::std::byte> const buf,
+    ::off_t const offset) noexcept {
+  return Offload([=] noexcept -> ::ssize_t {
+    ::ssize_t res;
+    do {
+      res = ::pread(fd, buf.data(), buf.size(), offset);
+    } while (res == -1 && errno == EINTR);
+    return res;
+  });
+}
+
+Result<::std::size_t, ::std::error_code> Write(
+    int const fd, ::std::span<::std::byte const> const buf,
+    ::off_t const offset) noexcept {
+  return Offload([=] noexcept -> ::ssize_t {
+    ::std::size_t done = 0;
+    // Keeps the partial progress, the error repeats on the next call
+    auto const fail = [&done] noexcept -> ::ssize_t {
+      return done != 0 ? static_cast<::ssize_t>(done) : -1;
+    };
+
+    while (done != buf.size()) {
+      auto const res = ::pwrite(fd, buf.data() + done, buf.size() - done,
+                                offset + static_cast<::off_t>(done));
+      if (res == -1) [[unlikely]] {
+        if (errno == EINTR) {
+          continue;
+        }
+        return fail();
+      }
+      if (res == 0) [[unlikely]] {
+        errno = EIO;
+        return fail();
+      }
+      done += static_cast<::std::size_t>(res);
+    }
+    return static_cast<::ssize_t>(done);
+  });
+}
+
+::std::error_code Fsync(int const fd, bool const data_only) noexcept {
+  auto const res = Offload([=] noexcept -> ::ssize_t {
+    return data_only ? ::fdatasync(fd) : ::fsync(fd);
+  });
+  return res ? ::std::error_code() : res.error();
+}
+
+} // namespace exe::fiber::fs
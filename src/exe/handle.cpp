@@ -2,7 +2,7 @@
 // handle.cpp
 // ~~~~~~~~~~
 //
-// Copyright (C) 2023-2025 Artyom Kolpakov <ddvamp007@gmail.com>
+// Copyright (C) 2023-2026 Artyom Kolpakov <ddvamp007@gmail.com>
 //
 // Licensed under GNU GPL-3.0-or-later.
 // See file LICENSE or <https://www.gnu.org/licenses/> for details.
@@ -34,6 +34,14 @@ void FiberHandle::Resume() && noexcept {
   ::std::move(*this).Schedule();
 }
 
+void FiberHandle::ScheduleLocal() && noexcept {
+  ReleaseChecked()->ScheduleLocal();
+}
+
+void FiberHandle::Wake() && noexcept {
+  ReleaseChecked()->Wake();
+}
+
 Fiber *FiberHandle::Release() noexcept {
   return ::std::exchange(fiber_, nullptr);
 }
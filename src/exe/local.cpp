@@ -0,0 +1,58 @@
+//
+// local.cpp
+// ~~~~~~~~~
+//
+// Copyright (C) 2026 Artyom Kolpakov <ddvamp007@gmail.com>
+//
+// Licensed under GNU GPL-3.0-or-later.
+// See file LICENSE or <https://www.gnu.org/licenses/> for details.
+//
+
+#include <exe/fiber/core/local.hpp>
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <stdexcept>
+#include <utility>
+
+namespace exe::fiber {
+
+namespace {
+
+::std::atomic_size_t key_count = 0;
+::std::array<::std::atomic<FiberLocalDestructor>, kMaxFiberLocals>
+    destructors = {};
+
+// To guarantee the expected implementation
+static_assert(::std::atomic<FiberLocalDestructor>::is_always_lock_free);
+
+} // namespace
+
+FiberLocalKey CreateFiberLocalKey(FiberLocalDestructor const destructor) {
+  auto key = key_count.load(::std::memory_order_relaxed);
+  do {
+    if (key == kMaxFiberLocals) [[unlikely]] {
+      throw ::std::length_error("Too many fiber-local keys");
+    }
+  } while (!key_count.compare_exchange_weak(key, key + 1,
+                                            ::std::memory_order_relaxed));
+
+  // Fibers that can see the key and store a value synchronize with this
+  // thread some other way, so they also see the destructor
+  destructors[key].store(destructor, ::std::memory_order_relaxed);
+  return key;
+}
+
+void DestroyFiberLocals(FiberLocalSlots &slots) noexcept {
+  for (auto key = 0uz; key != kMaxFiberLocals; ++key) {
+    if (auto const value = ::std::exchange(slots[key], nullptr)) {
+      if (auto const destructor =
+              destructors[key].load(::std::memory_order_relaxed)) {
+        destructor(value);
+      }
+    }
+  }
+}
+
+} // namespace exe::fiber
@@ -0,0 +1,178 @@
+//
+// parking_lot.cpp
+// ~~~~~~~~~~~~~~~
+//
+// Copyright (C) 2026 Artyom Kolpakov <ddvamp007@gmail.com>
+//
+// Licensed under GNU GPL-3.0-or-later.
+// See file LICENSE or <https://www.gnu.org/licenses/> for details.
+//
+
+#include <exe/fiber/sync/parking_lot.hpp>
+
+#include <exe/fiber/api.hpp>
+#include <exe/fiber/core/awaiter.hpp>
+#include <exe/fiber/core/handle.hpp>
+
+#include <concurrency/qspinlock.hpp>
+#include <util/intrusive/list.hpp>
+
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+
+namespace exe::fiber {
+
+namespace {
+
+// Power of two
+constexpr ::std::size_t kBuckets = 256;
+
+struct ParkedFiber : ::util::intrusive_list_node {
+  void const *addr;
+  FiberHandle handle;
+
+  explicit ParkedFiber(void const *const addr) noexcept : addr(addr) {}
+
+  [[nodiscard]] static ParkedFiber &From(::util::intrusive_list_node &node)
+      noexcept {
+    return static_cast<ParkedFiber &>(node);
+  }
+};
+
+// Fibers parked on the addresses with the same hash, in FIFO order
+struct Bucket {
+  ::concurrency::QSpinlock lock; // Protects waiters
+  ::util::intrusive_list_node waiters{&waiters, &waiters};
+
+  [[nodiscard]] bool HasWaiters(void const *const addr) noexcept {
+    for (auto node = waiters.next_; node != &waiters; node = node->next_) {
+      if (ParkedFiber::From(*node).addr == addr) {
+        return true;
+      }
+    }
+    return false;
+  }
+};
+
+::std::array<Bucket, kBuckets> buckets;
+
+[[nodiscard]] Bucket &GetBucket(void const *const addr) noexcept {
+  // Fibonacci hashing spreads neighbouring addresses over the table
+  auto const key = reinterpret_cast<::std::uintptr_t>(addr);
+  auto const hash = static_cast<::std::uint64_t>(key) * 0x9E37'79B9'7F4A'7C15;
+  return buckets[hash >> (64 - ::std::countr_zero(kBuckets))];
+}
+
+class ParkAwaiter final : public IAwaiter, public ParkedFiber {
+ private:
+  Bucket &bucket_;
+  detail::ParkValidate const validate_;
+  void *const ctx_;
+  bool parked_ = false;
+
+ public:
+  ParkAwaiter(void const *const addr, detail::ParkValidate const validate,
+              void *const ctx) noexcept
+      : ParkedFiber(addr)
+      , bucket_(GetBucket(addr))
+      , validate_(validate)
+      , ctx_(ctx) {}
+
+  [[nodiscard]] bool IsParked() const noexcept {
+    return parked_;
+  }
+
+  FiberHandle AwaitSymmetricSuspend(FiberHandle &&self) noexcept override {
+    auto guard = bucket_.lock.MakeGuard();
+
+    if (!validate_(ctx_)) {
+      // Continue the current fiber
+      return ::std::move(self);
+    }
+
+    handle = ::std::move(self);
+    parked_ = true;
+    link(bucket_.waiters);
+    return FiberHandle::Invalid();
+  }
+};
+
+} // namespace
+
+namespace detail {
+
+bool Park(void const *const addr, ParkValidate const validate,
+          void *const ctx) noexcept {
+  ParkAwaiter awaiter(addr, validate, ctx);
+  self::Suspend(awaiter);
+  return awaiter.IsParked();
+}
+
+UnparkResult UnparkOne(void const *const addr, UnparkCallback const callback,
+                       void *const ctx) noexcept {
+  auto &bucket = GetBucket(addr);
+  ParkedFiber *woken = nullptr;
+  UnparkResult result;
+
+  {
+    auto guard = bucket.lock.MakeGuard();
+
+    for (auto node = bucket.waiters.next_; node != &bucket.waiters;
+         node = node->next_) {
+      if (auto &fiber = ParkedFiber::From(*node); fiber.addr == addr) {
+        fiber.unlink();
+        woken = &fiber;
+        break;
+      }
+    }
+
+    result = {
+      .unparked = woken ? 1uz : 0uz,
+      .has_more = woken && bucket.HasWaiters(addr),
+    };
+
+    if (callback) {
+      callback(ctx, result);
+    }
+  }
+
+  if (woken) {
+    ::std::move(woken->handle).Wake();
+  }
+
+  return result;
+}
+
+::std::size_t UnparkAll(void const *const addr) noexcept {
+  auto &bucket = GetBucket(addr);
+  ::util::intrusive_list woken;
+  auto count = 0uz;
+
+  {
+    auto guard = bucket.lock.MakeGuard();
+
+    for (auto node = bucket.waiters.next_; node != &bucket.waiters;) {
+      auto const next = node->next_;
+      if (ParkedFiber::From(*node).addr == addr) {
+        node->unlink();
+        woken.push_back(*node);
+        ++count;
+      }
+      node = next;
+    }
+  }
+
+  while (!woken.empty()) {
+    // The node is destroyed when the fiber resumes
+    ::std::move(ParkedFiber::From(woken.pop_front()).handle).Wake();
+  }
+
+  return count;
+}
+
+} // namespace detail
+
+} // namespace exe::fiber
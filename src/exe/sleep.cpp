@@ -0,0 +1,119 @@
+//
+// sleep.cpp
+// ~~~~~~~~~
+//
+// Copyright (C) 2026 Artyom Kolpakov <ddvamp007@gmail.com>
+//
+// Licensed under GNU GPL-3.0-or-later.
+// See file LICENSE or <https://www.gnu.org/licenses/> for details.
+//
+
+#include <exe/fiber/api.hpp>
+#include <exe/fiber/core/awaiter.hpp>
+#include <exe/fiber/core/handle.hpp>
+#include <exe/runtime/reactor.hpp>
+#include <exe/runtime/timer_queue.hpp>
+
+#include <util/abort.hpp>
+
+#include <chrono>
+#include <thread>
+#include <utility>
+
+namespace exe::fiber {
+
+namespace {
+
+/* Thread that runs a reactor only for timers of sleeping fibers */
+class TimerService {
+ private:
+  runtime::Reactor reactor_;
+  ::std::thread thread_;
+
+ public:
+  ~TimerService() {
+    reactor_.Stop();
+    thread_.join();
+    reactor_.Close();
+  }
+
+  TimerService(TimerService const &) = delete;
+  void operator= (TimerService const &) = delete;
+
+  TimerService(TimerService &&) = delete;
+  void operator= (TimerService &&) = delete;
+
+ public:
+  TimerService() try {
+    reactor_.Init(1);
+    thread_ = ::std::thread([this] noexcept { reactor_.Run(); });
+  } catch (...) {
+    UTIL_ABORT("Unexpected exception when starting the timer service");
+  }
+
+  [[nodiscard]] static TimerService &Get() noexcept {
+    static TimerService instance;
+    return instance;
+  }
+
+  // May be called from any thread
+  void Submit(runtime::TimerOperation &op,
+              runtime::Reactor::Clock::time_point const deadline) noexcept {
+    reactor_.SubmitTimer(op, deadline);
+  }
+};
+
+class SleepAwaiter final : public IAwaiter, public runtime::TimerOperation {
+ private:
+  Clock::time_point const deadline_;
+  FiberHandle handle_;
+
+ public:
+  explicit SleepAwaiter(Clock::time_point const deadline) noexcept
+      : deadline_(deadline) {}
+
+  FiberHandle AwaitSymmetricSuspend(FiberHandle &&self) noexcept override {
+    handle_ = ::std::move(self);
+    TimerService::Get().Submit(*this, deadline_);
+
+    // From now on, the awaiter may be destroyed at any time
+    return FiberHandle::Invalid();
+  }
+
+  // runtime::TimerOperation
+  void OnTimer() noexcept override {
+    ::std::move(handle_).Schedule();
+  }
+};
+
+} // namespace
+
+namespace self {
+
+void SleepFor(::std::chrono::steady_clock::duration const duration) noexcept {
+  using Clock = ::std::chrono::steady_clock;
+
+  if (duration <= Clock::duration::zero()) {
+    return;
+  }
+
+  // Saturate rather than overflow for huge durations
+  auto const now = Clock::now();
+  SleepUntil(duration < Clock::time_point::max() - now
+                 ? now + duration
+                 : Clock::time_point::max());
+}
+
+void SleepUntil(::std::chrono::steady_clock::time_point const deadline)
+    noexcept {
+  if (deadline <= ::std::chrono::steady_clock::now()) {
+    return;
+  }
+
+  SleepAwaiter awaiter(deadline);
+  Suspend(awaiter);
+}
+
+} // namespace self
+
+} // namespace exe::fiber
@@ -2,7 +2,7 @@
 // stack.cpp
 // ~~~~~~~~~
 //
-// Copyright (C) 2023-2025 Artyom Kolpakov <ddvamp007@gmail.com>
+// Copyright (C) 2023-2026 Artyom Kolpakov <ddvamp007@gmail.com>
 //
 // Licensed under GNU GPL-3.0-or-later.
 // See file LICENSE or <https://www.gnu.org/licenses/> for details.
@@ -14,24 +14,148 @@
 #include <util/debug/assert.hpp>
 #include <util/intrusive/forward_list.hpp>
 #include <util/intrusive/stack.hpp>
+#include <util/macro.hpp>
 #include <util/memory/page_allocation.hpp>
 #include <util/memory/view.hpp>
 
+#include <sys/mman.h>
+
+#include <algorithm>
+#include <array>
+#include <atomic>
 #include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <span>
 #include <utility>
 
 namespace exe::fiber {
 
 namespace {
 
-class StackAllocator {
+struct Node : ::util::intrusive_forward_list_node<Node> {
+  Stack stack;
+  bool trimmed = false; // Not used since the last trim
+};
+
+[[nodiscard]] Node &MakeNode(Stack &&stack) noexcept {
+  UTIL_ASSERT(stack.AllocationSize() != 0, "Stack in moved-from state");
+  return *::new (stack.Memory()) Node{.stack = ::std::move(stack)};
+}
+
+/* profiling */
+
+constexpr ::std::uint64_t kPaint = 0xCDCD'CDCD'CDCD'CDCD;
+
+::std::atomic_bool profiling = false;
+
+// Whole stack except the place of Node
+[[nodiscard]] ::std::span<::std::uint64_t> PaintArea(Stack &stack) noexcept {
+  constexpr auto kNodeWords =
+      (sizeof(Node) + sizeof(::std::uint64_t) - 1) / sizeof(::std::uint64_t);
+
+  auto const view = stack.View();
+  return {reinterpret_cast<::std::uint64_t *>(stack.Memory()) + kNodeWords,
+          reinterpret_cast<::std::uint64_t *>(view.data() + view.size())};
+}
+
+// Stacks grow down, so the used part is above the last painted word
+[[nodiscard]] ::std::size_t MeasureUsedBytes(
+    ::std::span<::std::uint64_t const> const area) noexcept {
+  auto const it = ::std::ranges::find_if(
+      area, [](::std::uint64_t const word) { return word != kPaint; });
+  return static_cast<::std::size_t>(area.end() - it) *
+         sizeof(::std::uint64_t);
+}
+
+class UsageProfile {
  private:
-  struct Node : ::util::intrusive_forward_list_node<Node> {
-    Stack stack;
-  };
+  ::std::atomic_uint64_t samples_ = 0;
+  ::std::atomic_size_t max_bytes_ = 0;
+  ::std::array<::std::atomic_uint64_t, StackUsage::kBuckets> histogram_ = {};
 
+ public:
+  void Record(::std::size_t const used) noexcept {
+    auto idx = 0uz;
+    while (idx + 1 != StackUsage::kBuckets &&
+           used > StackUsage::BucketLimit(idx)) {
+      ++idx;
+    }
+
+    histogram_[idx].fetch_add(1, ::std::memory_order_relaxed);
+    samples_.fetch_add(1, ::std::memory_order_relaxed);
+
+    auto max = max_bytes_.load(::std::memory_order_relaxed);
+    while (max < used && !max_bytes_.compare_exchange_weak(
+                             max, used, ::std::memory_order_relaxed)) {}
+  }
+
+  [[nodiscard]] StackUsage Get() const noexcept {
+    StackUsage usage = {
+      .samples = samples_.load(::std::memory_order_relaxed),
+      .max_bytes = max_bytes_.load(::std::memory_order_relaxed),
+      .histogram = {},
+    };
+    for (auto idx = 0uz; idx != StackUsage::kBuckets; ++idx) {
+      usage.histogram[idx] = histogram_[idx].load(::std::memory_order_relaxed);
+    }
+    return usage;
+  }
+};
+
+::std::array<UsageProfile, kStackSizeClasses> profiles;
+
+/* trimming */
+
+// Top part of a stack that stays resident in the depot
+constexpr ::std::size_t kHotBytes = 16 * 1024;
+// Memory of stacks kept in one depot, the excess is unmapped
+constexpr ::std::size_t kMaxDepotBytes = 64 * 1024 * 1024;
+
+/**
+ *  Releases the physical memory of a stack below the hot part. Stacks grow
+ *  down, so if the page just below the hot part is not resident, the fiber
+ *  was shallow and there is nothing to release. MADV_DONTNEED is used
+ *  instead of MADV_FREE to drop RSS immediately
+ */
+void TrimStack(Stack &stack) noexcept {
+  if (IsStackProfilingEnabled()) [[unlikely]] {
+    // Released pages would lose the paint
+    return;
+  }
+
+  auto const page = ::util::page_allocation::page_size();
+  auto const view = stack.View();
+  auto const top = view.data() + view.size();
+  auto const bottom = stack.Memory() + page; // Node stays in the first page
+
+  if (top - bottom <= static_cast<::std::ptrdiff_t>(kHotBytes)) {
+    return;
+  }
+
+  auto const end = top - kHotBytes;
+  unsigned char resident = 0;
+  if (::mincore(end - page, page, &resident) == 0 && !(resident & 1)) {
+    return;
+  }
+
+  ::madvise(bottom, static_cast<::std::size_t>(end - bottom), MADV_DONTNEED);
+}
+
+void TrimNode(Node &node) noexcept {
+  if (!::std::exchange(node.trimmed, true)) {
+    TrimStack(node.stack);
+  }
+}
+
+// Global depot of cached stacks of one size class
+class StackAllocator {
+ private:
+  StackSize const size_;
+  ::std::size_t const max_count_;
   ::util::intrusive_stack<Node> nodes_;
-  ::concurrency::QSpinlock lock_; // Protects nodes_
+  ::std::size_t count_ = 0;
+  ::concurrency::QSpinlock lock_; // Protects nodes_ and count_
 
  public:
   ~StackAllocator() {
@@ -47,44 +171,277 @@ class StackAllocator {
   void operator= (StackAllocator &&) = delete;
 
  public:
-  StackAllocator() = default;
+  constexpr explicit StackAllocator(StackSize const size) noexcept
+      : size_(size)
+      , max_count_(::std::max(kMaxDepotBytes / StackBytes(size), 1uz)) {}
 
-  Stack Allocate() {
+  // Moves up to count stacks to out, returns the number of moved
+  ::std::size_t TakeBatch(::util::intrusive_stack<Node> &out,
+                          ::std::size_t const count) noexcept {
+    auto guard = lock_.MakeGuard();
+    auto moved = 0uz;
+    for (; moved != count && !nodes_.empty(); ++moved) {
+      out.push(nodes_.pop());
+    }
+    count_ -= moved;
+    return moved;
+  }
+
+  // Pre: in contains at least count stacks
+  void PutBatch(::util::intrusive_stack<Node> &in,
+                ::std::size_t const count) noexcept {
+    // Stacks in the depot are cold, so trim them outside of the lock
+    ::util::intrusive_stack<Node> batch;
+    for (auto idx = 0uz; idx != count; ++idx) {
+      auto &node = in.pop();
+      TrimNode(node);
+      batch.push(node);
+    }
+
+    ::util::intrusive_stack<Node> excess;
     {
       auto guard = lock_.MakeGuard();
-      if (!nodes_.empty()) [[likely]] {
-        return ::std::move(nodes_.pop()).stack;
+      while (!batch.empty()) {
+        auto &node = batch.pop();
+        if (count_ == max_count_) [[unlikely]] {
+          excess.push(node);
+        } else {
+          nodes_.push(node);
+          ++count_;
+        }
       }
     }
 
-    return AllocateNewStack();
+    while (!excess.empty()) {
+      excess.pop().~Node();
+    }
+  }
+
+  Stack AllocateNewStack() const {
+    auto stack = Stack::AllocateBytes(StackBytes(size_));
+    if (IsStackProfilingEnabled()) [[unlikely]] {
+      ::std::ranges::fill(PaintArea(stack), kPaint);
+    }
+    return stack;
+  }
+};
+
+// Constant initialization, so that fibers may be spawned by static
+// initializers of other translation units. Some compilers reject it for
+// an array of self-referencing locks, hence separate objects
+constinit StackAllocator allocator_16k(StackSize::k16K);
+constinit StackAllocator allocator_64k(StackSize::k64K);
+constinit StackAllocator allocator_256k(StackSize::k256K);
+constinit StackAllocator allocator_1m(StackSize::k1M);
+
+constinit ::std::array<StackAllocator *, kStackSizeClasses> allocators = {
+  &allocator_16k,
+  &allocator_64k,
+  &allocator_256k,
+  &allocator_1m,
+};
+
+::std::atomic<StackSize> default_size = StackSize::k1M;
+
+[[nodiscard]] StackAllocator &GetAllocator(StackSize const size) noexcept {
+  return *allocators[static_cast<::std::size_t>(size)];
+}
+
+// Size class is not stored, so it is recovered from the allocation size.
+// Empty for stacks of other sizes, e.g. made by Stack::AllocateBytes
+[[nodiscard]] ::std::optional<StackSize> GetSizeClass(Stack &stack) noexcept {
+  auto const pages = ::util::page_allocation::bytes_to_pages(
+      stack.AllocationSize()) - 1; // Guard page
+
+  for (auto idx = 0uz; idx != kStackSizeClasses; ++idx) {
+    auto const size = static_cast<StackSize>(idx);
+    if (pages == ::util::page_allocation::bytes_to_pages(StackBytes(size))) {
+      return size;
+    }
+  }
+
+  return ::std::nullopt;
+}
+
+/**
+ *  Bounded per-thread cache of stacks in front of the depot. Stacks are
+ *  exchanged with the depot in batches, so that spawning and finishing
+ *  fibers on one thread mostly do not touch shared state
+ *
+ *  Stacks are reused in LIFO order, so only the top kHotStacks are likely
+ *  to run soon. A stack that sinks below them is trimmed like in the depot.
+ *  The top ones are tracked separately, so that the one sinking is known
+ *  without walking the list through cold stacks
+ */
+class StackMagazine {
+ private:
+  inline static constexpr ::std::size_t kCapacity = 16;
+  inline static constexpr ::std::size_t kBatch = kCapacity / 2;
+  inline static constexpr ::std::size_t kHotStacks = 4;
+
+  StackAllocator &depot_;
+  ::util::intrusive_stack<Node> nodes_;
+  ::std::size_t count_ = 0;
+
+  // Ring of the top nodes, oldest first. Other nodes are already trimmed
+  ::std::array<Node *, kHotStacks> hot_{};
+  ::std::size_t hot_begin_ = 0;
+  ::std::size_t hot_count_ = 0;
+
+ public:
+  ~StackMagazine() {
+    depot_.PutBatch(nodes_, ::std::exchange(count_, 0));
+  }
+
+  StackMagazine(StackMagazine const &) = delete;
+  void operator= (StackMagazine const &) = delete;
+
+  StackMagazine(StackMagazine &&) = delete;
+  void operator= (StackMagazine &&) = delete;
+
+ public:
+  explicit StackMagazine(StackAllocator &depot) noexcept
+      : depot_(depot) {}
+
+  Stack Allocate() {
+    if (count_ == 0) [[unlikely]] {
+      count_ = depot_.TakeBatch(nodes_, kBatch);
+      if (count_ == 0) {
+        return depot_.AllocateNewStack();
+      }
+    }
+
+    --count_;
+    return ::std::move(Pop()).stack;
+  }
+
+  void AllocateBatch(::std::span<Stack> const out) {
+    auto filled = 0uz;
+    for (; filled != out.size() && count_ != 0; ++filled, --count_) {
+      out[filled] = ::std::move(Pop()).stack;
+    }
+
+    if (filled != out.size()) {
+      // The rest of the batch comes from the depot in one lock acquisition
+      ::util::intrusive_stack<Node> taken;
+      auto const moved = depot_.TakeBatch(taken, out.size() - filled);
+      for (auto idx = 0uz; idx != moved; ++idx, ++filled) {
+        out[filled] = ::std::move(taken.pop()).stack;
+      }
+    }
+
+    try {
+      for (; filled != out.size(); ++filled) {
+        out[filled] = depot_.AllocateNewStack();
+      }
+    } catch (...) {
+      for (auto &stack : out.first(filled)) {
+        Deallocate(::std::move(stack));
+      }
+      throw;
+    }
   }
 
   void Deallocate(Stack &&stack) noexcept {
-    UTIL_ASSERT(stack.AllocationSize() != 0, "Stack in moved-from state");
+    if (count_ == kCapacity) [[unlikely]] {
+      // The batch is taken from the top, where all the hot nodes are
+      depot_.PutBatch(nodes_, kBatch);
+      count_ -= kBatch;
+      hot_count_ = 0;
+    }
 
-    auto node = ::new (stack.Memory()) Node{.stack = ::std::move(stack)};
-    auto guard = lock_.MakeGuard();
-    nodes_.push(*node);
+    auto &node = MakeNode(::std::move(stack));
+    nodes_.push(node);
+    ++count_;
+
+    if (hot_count_ == kHotStacks) {
+      // The oldest hot node sinks below the others
+      TrimNode(*::std::exchange(hot_[hot_begin_], &node));
+      hot_begin_ = (hot_begin_ + 1) % kHotStacks;
+    } else {
+      hot_[(hot_begin_ + hot_count_) % kHotStacks] = &node;
+      ++hot_count_;
+    }
   }
 
  private:
-  static Stack AllocateNewStack() {
-    constexpr ::std::size_t kStackBytes = 1024 * 1024; // 1MB
-    return Stack::AllocateBytes(kStackBytes);
+  Node &Pop() noexcept {
+    auto &node = nodes_.pop();
+    if (hot_count_ != 0) {
+      // The newest hot node is the top one
+      --hot_count_;
+      UTIL_ASSERT(hot_[(hot_begin_ + hot_count_) % kHotStacks] == &node,
+                  "Internal error! Hot stacks are out of order");
+    }
+    return node;
   }
 };
 
-StackAllocator allocator;
+thread_local ::std::array<StackMagazine, kStackSizeClasses> magazines = {
+  StackMagazine(GetAllocator(StackSize::k16K)),
+  StackMagazine(GetAllocator(StackSize::k64K)),
+  StackMagazine(GetAllocator(StackSize::k256K)),
+  StackMagazine(GetAllocator(StackSize::k1M)),
+};
+
+[[nodiscard]] StackMagazine &GetMagazine(StackSize const size) noexcept {
+  return magazines[static_cast<::std::size_t>(size)];
+}
 
 } // namespace
 
+StackSize GetDefaultStackSize() noexcept {
+  return default_size.load(::std::memory_order_relaxed);
+}
+
+void SetDefaultStackSize(StackSize const size) noexcept {
+  default_size.store(size, ::std::memory_order_relaxed);
+}
+
+Stack AllocateStack(StackSize const size) {
+  return GetMagazine(size).Allocate();
+}
+
 Stack AllocateStack() {
-  return allocator.Allocate();
+  return AllocateStack(GetDefaultStackSize());
+}
+
+void AllocateStacks(StackSize const size, ::std::span<Stack> const out) {
+  GetMagazine(size).AllocateBatch(out);
 }
 
 void DeallocateStack(Stack &&stack) noexcept {
-  allocator.Deallocate(::std::move(stack));
+  if (auto const size = GetSizeClass(stack)) [[likely]] {
+    GetMagazine(*size).Deallocate(::std::move(stack));
+  } else {
+    // Does not fit any pool, so it is released right away
+    UTIL_IGNORE(auto(::std::move(stack)));
+  }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+void EnableStackProfiling() noexcept {
+  profiling.store(true, ::std::memory_order_relaxed);
+}
+
+bool IsStackProfilingEnabled() noexcept {
+  return profiling.load(::std::memory_order_relaxed);
+}
+
+void RecordStackUsage(Stack &stack) noexcept {
+  auto const area = PaintArea(stack);
+  auto const used = MeasureUsedBytes(area);
+  if (auto const size = GetSizeClass(stack)) [[likely]] {
+    profiles[static_cast<::std::size_t>(*size)].Record(used);
+  }
+
+  // Keep the stack painted for the next fiber
+  ::std::ranges::fill(area.last(used / sizeof(::std::uint64_t)), kPaint);
+}
+
+StackUsage GetStackUsage(StackSize const size) noexcept {
+  return profiles[static_cast<::std::size_t>(size)].Get();
 }
 
 } // namespace exe::fiber
@@ -12,10 +12,12 @@
 
 #include <exe/runtime/tp/thread_pool.hpp>
 
+#include <exe/runtime/task/priority.hpp>
 #include <exe/runtime/task/task.hpp>
 
 #include <util/abort.hpp>
 #include <util/debug/assert.hpp>
+#include <util/intrusive/queue.hpp>
 
 #include <cstddef>
 #include <thread>
@@ -27,6 +29,12 @@ namespace {
 
 thread_local ThreadPool *current_pool = nullptr;
 
+// Queue of the current worker, only accessed by its thread
+thread_local ::util::intrusive_queue<task::TaskBase> local_tasks;
+
+// Whether the next task is taken from the shared queue, if it has any
+thread_local bool take_shared = false;
+
 ::std::size_t NormalizeWorkerCount(::std::size_t const requested) noexcept {
   ::std::size_t const available = ::std::thread::hardware_concurrency();
   return (available == 0 || requested < available) ? requested : available;
@@ -75,6 +83,41 @@ void ThreadPool::Start() {
   tasks_.Push(*task);
 }
 
+/* virtual */ void ThreadPool::SubmitWithPriority(
+    task::TaskBase *task, task::Priority const priority) {
+  UTIL_ASSERT(state_ == kStarted, "Using a non-working thread pool");
+  UTIL_ASSERT(task, "nullptr instead of task");
+  tasks_.Push(*task, priority);
+}
+
+/* virtual */ void ThreadPool::SubmitLocal(task::TaskBase *task) {
+  UTIL_ASSERT(state_ == kStarted, "Using a non-working thread pool");
+  UTIL_ASSERT(task, "nullptr instead of task");
+
+  if (current_pool == this) [[likely]] {
+    local_tasks.push(*task);
+  } else {
+    tasks_.Push(*task);
+  }
+}
+
+/* virtual */ void ThreadPool::SubmitBatch(task::TaskBase *head) {
+  UTIL_ASSERT(state_ == kStarted, "Using a non-working thread pool");
+
+  ::util::intrusive_queue<task::TaskBase> batch;
+  auto count = 0uz;
+  while (head) {
+    auto const next = head->Next();
+    batch.push(*head);
+    head = next;
+    ++count;
+  }
+
+  if (count != 0) [[likely]] {
+    tasks_.PushBatch(batch, count);
+  }
+}
+
 void ThreadPool::Stop() noexcept try {
   UTIL_ASSERT(state_ == kStarted,
               "Attempt to stop non-working thread pool");
@@ -90,13 +133,30 @@ void ThreadPool::Stop() noexcept try {
 void ThreadPool::WorkLoop() noexcept try {
   current_pool = this;
 
-  while (auto task = tasks_.Pop()) {
+  while (auto task = NextTask()) {
     ::std::move(*task).Run();
   }
 } catch (...) {
   UTIL_ABORT("Unexpected exception inside ThreadPool's worker thread");
 }
 
+task::TaskBase *ThreadPool::NextTask() {
+  if (local_tasks.empty()) {
+    // Only this thread fills the local queue, so it is safe to block
+    return tasks_.Pop();
+  }
+
+  // While both queues have tasks, they alternate, so neither starves
+  take_shared = !take_shared;
+  if (take_shared && tasks_.HasTasksHint()) {
+    if (auto const task = tasks_.TryPop()) {
+      return task;
+    }
+  }
+
+  return &local_tasks.pop();
+}
+
 void ThreadPool::JoinWorkerThreads() {
   for (auto &w : workers_) {
     w.join();
@@ -0,0 +1,184 @@
+//
+// transfer.cpp
+// ~~~~~~~~~~~~
+//
+// Copyright (C) 2026 Artyom Kolpakov <ddvamp007@gmail.com>
+//
+// Licensed under GNU GPL-3.0-or-later.
+// See file LICENSE or <https://www.gnu.org/licenses/> for details.
+//
+
+#include <exe/fiber/io/transfer.hpp>
+#include <exe/fiber/io/wait.hpp>
+#include <exe/runtime/reactor.hpp>
+
+#include <util/debug/assert.hpp>
+
+#include <fcntl.h> // splice
+#include <unistd.h>
+#include <sys/sendfile.h>
+
+#include <algorithm>
+#include <cerrno>
+#include <cstddef>
+#include <system_error>
+#include <utility>
+
+namespace exe::fiber::io {
+
+namespace {
+
+// Limits a single syscall, so that one transfer does not monopolize the fd
+constexpr ::std::size_t kMaxChunk = 1 << 20; // 1MB
+
+[[nodiscard]] bool WouldBlock(int const err) noexcept {
+  return err == EAGAIN || err == EWOULDBLOCK;
+}
+
+void CloseFd(int &fd) noexcept {
+  if (fd != -1) {
+    ::close(::std::exchange(fd, -1));
+  }
+}
+
+} // namespace
+
+////////////////////////////////////////////////////////////////////////////////
+
+SplicePipe::~SplicePipe() {
+  Close();
+}
+
+::std::error_code SplicePipe::Open() noexcept {
+  if (IsOpen()) {
+    return {};
+  }
+
+  int fds[2];
+  if (::pipe2(fds, O_NONBLOCK | O_CLOEXEC) == -1) [[unlikely]] {
+    return ErrnoToErrorCode();
+  }
+
+  read_fd_ = fds[0];
+  write_fd_ = fds[1];
+  return {};
+}
+
+void SplicePipe::Close() noexcept {
+  CloseFd(read_fd_);
+  CloseFd(write_fd_);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+TransferResult SendFile(runtime::Reactor &reactor, int const out_fd,
+                        int const in_fd, ::off_t offset,
+                        ::std::size_t const count) noexcept {
+  TransferResult res;
+
+  while (res.bytes != count) {
+    auto const chunk = ::std::min(count - res.bytes, kMaxChunk);
+    auto const sent = ::sendfile(out_fd, in_fd, &offset, chunk);
+
+    if (sent > 0) [[likely]] {
+      res.bytes += static_cast<::std::size_t>(sent);
+      continue;
+    }
+
+    if (sent == 0) {
+      // End of file
+      break;
+    }
+
+    if (errno == EINTR) [[unlikely]] {
+      continue;
+    }
+
+    if (!WouldBlock(errno)) [[unlikely]] {
+      res.error = ErrnoToErrorCode();
+      break;
+    }
+
+    if (auto const ec = WaitWritable(reactor, out_fd)) [[unlikely]] {
+      res.error = ec;
+      break;
+    }
+  }
+
+  return res;
+}
+
+TransferResult Splice(runtime::Reactor &reactor, int const in_fd,
+                      int const out_fd, ::std::size_t const count,
+                      SplicePipe &pipe) noexcept {
+  TransferResult res;
+
+  if (auto const ec = pipe.Open()) [[unlikely]] {
+    res.error = ec;
+    return res;
+  }
+
+  constexpr unsigned kFlags = SPLICE_F_MOVE | SPLICE_F_NONBLOCK;
+
+  ::std::size_t buffered = 0; // Bytes in pipe
+  auto eof = false;
+
+  while (res.bytes != count && !res.error) {
+    // Fill the pipe
+    if (buffered == 0 && !eof) {
+      auto const chunk = ::std::min(count - res.bytes, kMaxChunk);
+      auto const moved = ::splice(in_fd, nullptr, pipe.WriteEnd(), nullptr,
+                                  chunk, kFlags);
+
+      if (moved > 0) [[likely]] {
+        buffered = static_cast<::std::size_t>(moved);
+      } else if (moved == 0) {
+        eof = true;
+      } else if (errno == EINTR) [[unlikely]] {
+        continue;
+      } else if (WouldBlock(errno)) {
+        res.error = WaitReadable(reactor, in_fd);
+        continue;
+      } else [[unlikely]] {
+        res.error = ErrnoToErrorCode();
+        break;
+      }
+    }
+
+    if (buffered == 0) {
+      UTIL_ASSERT(eof, "Internal error! Empty pipe before the end of input");
+      break;
+    }
+
+    // Drain the pipe
+    auto const moved = ::splice(pipe.ReadEnd(), nullptr, out_fd, nullptr,
+                                buffered, kFlags);
+
+    if (moved > 0) [[likely]] {
+      buffered -= static_cast<::std::size_t>(moved);
+      res.bytes += static_cast<::std::size_t>(moved);
+    } else if (moved == -1 && errno == EINTR) [[unlikely]] {
+      continue;
+    } else if (moved == -1 && WouldBlock(errno)) {
+      res.error = WaitWritable(reactor, out_fd);
+    } else [[unlikely]] {
+      res.error = (moved == 0) ? ::std::make_error_code(::std::errc::io_error)
+                               : ErrnoToErrorCode();
+    }
+  }
+
+  if (buffered != 0) [[unlikely]] {
+    // Bytes that will never be delivered are left in pipe
+    pipe.Close();
+  }
+
+  return res;
+}
+
+TransferResult Splice(runtime::Reactor &reactor, int const in_fd,
+                      int const out_fd, ::std::size_t const count) noexcept {
+  SplicePipe pipe;
+  return Splice(reactor, in_fd, out_fd, count, pipe);
+}
+
+} // namespace exe::fiber::io
@@ -0,0 +1,207 @@
+//
+// t_acceptor.cpp
+// ~~~~~~~~~~~~~~
+//
+// Copyright (C) 2026 Artyom Kolpakov <ddvamp007@gmail.com>
+//
+// Licensed under GNU GPL-3.0-or-later.
+// See file LICENSE or <https://www.gnu.org/licenses/> for details.
+//
+
+#include <exe/runtime/acceptor.hpp>
+#include <exe/runtime/reactor.hpp>
+
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <format>
+#include <iostream>
+#include <thread>
+#include <vector>
+
+class Worker final : public exe::runtime::ConnectionHandoff {
+ public:
+  ::std::atomic_int connections = 0;
+
+  ~Worker() {
+    Close();
+  }
+
+  void OnConnection(int const fd) noexcept override {
+    ::close(fd);
+    connections.fetch_add(1, ::std::memory_order_relaxed);
+  }
+};
+
+int Listen(::sockaddr_in &addr) {
+  auto const fd = ::socket(AF_INET, SOCK_STREAM | SOCK_NONBLOCK, 0);
+  addr = {};
+  addr.sin_family = AF_INET;
+  addr.sin_addr.s_addr = ::htonl(INADDR_LOOPBACK);
+  auto len = static_cast<::socklen_t>(sizeof(addr));
+  if (fd == -1 ||
+      ::bind(fd, reinterpret_cast<::sockaddr *>(&addr), sizeof(addr)) != 0 ||
+      ::listen(fd, 4096) != 0 ||
+      ::getsockname(fd, reinterpret_cast<::sockaddr *>(&addr), &len) != 0) {
+    ThrowErrno();
+  }
+  return fd;
+}
+
+bool Connect(::sockaddr_in const &addr) {
+  auto const fd = ::socket(AF_INET, SOCK_STREAM, 0);
+  if (fd == -1) {
+    return false;
+  }
+  auto const res = ::connect(fd, reinterpret_cast<::sockaddr const *>(&addr),
+                             sizeof(addr));
+  ::close(fd);
+  return res == 0;
+}
+
+int TestAcceptorHandoff() {
+  ::sockaddr_in addr;
+  auto const listener = Listen(addr);
+
+  exe::runtime::Reactor acceptor_reactor;
+  exe::runtime::Reactor first_reactor;
+  exe::runtime::Reactor second_reactor;
+  acceptor_reactor.Init(64);
+  first_reactor.Init(64);
+  second_reactor.Init(64);
+
+  Worker first;
+  Worker second;
+  first.Init(first_reactor);
+  second.Init(second_reactor);
+
+  exe::runtime::ConnectionHandoff *const workers[] = {&first, &second};
+  exe::runtime::Acceptor acceptor(acceptor_reactor, listener, workers);
+  if (acceptor.Start()) {
+    return EXIT_FAILURE;
+  }
+
+  ::std::thread threads[] = {
+    ::std::thread([&] { acceptor_reactor.Run(); }),
+    ::std::thread([&] { first_reactor.Run(); }),
+    ::std::thread([&] { second_reactor.Run(); }),
+  };
+
+  constexpr auto kConnections = 2000;
+  for (auto cnt = 0; cnt != kConnections; ++cnt) {
+    if (!Connect(addr)) {
+      return EXIT_FAILURE;
+    }
+  }
+
+  auto const total = [&] {
+    return first.connections.load() + second.connections.load();
+  };
+  while (total() != kConnections) {
+    ::std::this_thread::yield();
+  }
+
+  acceptor_reactor.Stop();
+  first_reactor.Stop();
+  second_reactor.Stop();
+  for (auto &t : threads) {
+    t.join();
+  }
+
+  auto const stats = acceptor.GetStats();
+  ::std::cout << ::std::format("accepted: {}, batches: {}, wakeups: {}\n",
+                               stats.accepted, stats.batches, stats.wakeups);
+
+  auto const ok = !acceptor.Stop() && stats.accepted == kConnections &&
+                  stats.errors == 0 && first.connections != 0 &&
+                  second.connections != 0;
+
+  first.Close();
+  second.Close();
+  acceptor_reactor.Close();
+  first_reactor.Close();
+  second_reactor.Close();
+  ::close(listener);
+
+  return ok ? EXIT_SUCCESS : EXIT_FAILURE;
+}
+
+int TestAcceptorBackoff() {
+  using namespace ::std::chrono_literals;
+
+  ::sockaddr_in addr;
+  auto const listener = Listen(addr);
+
+  exe::runtime::Reactor reactor;
+  reactor.Init(64);
+
+  Worker worker;
+  worker.Init(reactor);
+
+  exe::runtime::ConnectionHandoff *const workers[] = {&worker};
+  exe::runtime::Acceptor acceptor(reactor, listener, workers);
+  if (acceptor.Start()) {
+    return EXIT_FAILURE;
+  }
+
+  // Exhaust fds, leaving one for the client socket
+  ::std::vector<int> fillers;
+  while (true) {
+    auto const fd = ::dup(listener);
+    if (fd == -1) {
+      break;
+    }
+    fillers.push_back(fd);
+  }
+  ::close(fillers.back());
+  fillers.pop_back();
+
+  if (!Connect(addr)) {
+    return EXIT_FAILURE;
+  }
+
+  ::std::thread poller([&] { reactor.Run(); });
+
+  // accept4 fails with EMFILE, so the listener has to back off
+  // instead of being reported again on every poll
+  ::std::this_thread::sleep_for(50ms);
+  auto const exhausted = acceptor.GetStats();
+
+  for (auto const fd : fillers) {
+    ::close(fd);
+  }
+  while (worker.connections.load() != 1) {
+    ::std::this_thread::yield();
+  }
+
+  reactor.Stop();
+  poller.join();
+
+  auto const stats = acceptor.GetStats();
+  ::std::cout << ::std::format("wakeups: {}, errors: {}, backoffs: {}\n",
+                               exhausted.wakeups, exhausted.errors,
+                               exhausted.backoffs);
+
+  auto const ok = !acceptor.Stop() && exhausted.backoffs != 0 &&
+                  exhausted.wakeups < 20 && stats.accepted == 1;
+
+  worker.Close();
+  reactor.Close();
+  ::close(listener);
+
+  return ok ? EXIT_SUCCESS : EXIT_FAILURE;
+}
+
+int main() {
+  for (auto test : {TestAcceptorHandoff, TestAcceptorBackoff}) {
+    if (auto const res = test(); res != EXIT_SUCCESS) {
+      return res;
+    }
+  }
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,106 @@
+//
+// t_buffer_pool.cpp
+// ~~~~~~~~~~~~~~~~~
+//
+// Copyright (C) 2026 Artyom Kolpakov <ddvamp007@gmail.com>
+//
+// Licensed under GNU GPL-3.0-or-later.
+// See file LICENSE or <https://www.gnu.org/licenses/> for details.
+//
+
+#include <exe/runtime/buffer_pool.hpp>
+
+#include <cstddef>
+#include <cstdlib>
+#include <thread>
+#include <utility>
+#include <vector>
+
+int TestBufferPoolLimits() {
+  // 2 slabs of 4 buffers
+  exe::runtime::BufferPool pool(100, 4, 2);
+  if (pool.BufferSize() != 128) {
+    return EXIT_FAILURE;
+  }
+
+  ::std::vector<exe::runtime::Buffer> buffers;
+  for (auto cnt = 0; cnt != 8; ++cnt) {
+    buffers.push_back(pool.TryAcquire());
+    if (!buffers.back() || buffers.back().Size() != 128) {
+      return EXIT_FAILURE;
+    }
+  }
+
+  if (pool.TryAcquire() || pool.GetSlabs().size() != 2) {
+    return EXIT_FAILURE;
+  }
+
+  // The last reference returns the buffer to the pool
+  buffers.pop_back();
+  auto buffer = pool.TryAcquire();
+  return buffer ? EXIT_SUCCESS : EXIT_FAILURE;
+}
+
+int TestBufferSharing() {
+  exe::runtime::BufferPool pool(64, 1, 1);
+
+  auto buffer = pool.Acquire();
+  buffer.Data()[10] = ::std::byte{42};
+
+  auto slice = buffer.Slice(10, 20);
+  if (buffer.IsUnique() || slice.Size() != 20 ||
+      slice.Data()[0] != ::std::byte{42}) {
+    return EXIT_FAILURE;
+  }
+
+  slice.Truncate(5);
+  buffer.Reset();
+  if (!slice.IsUnique() || slice.Size() != 5 || pool.TryAcquire()) {
+    return EXIT_FAILURE;
+  }
+
+  // Attach takes back the whole buffer with its contents
+  auto const id = ::std::move(slice).Detach();
+  auto attached = pool.Attach(id);
+  auto const ok = attached.GetId() == id && attached.Size() == 64 &&
+                  attached.Data()[10] == ::std::byte{42};
+  return ok ? EXIT_SUCCESS : EXIT_FAILURE;
+}
+
+int TestThreadCaches() {
+  exe::runtime::BufferPool pool(4096, 64, 16);
+
+  ::std::vector<::std::thread> threads;
+  for (auto cnt = 0; cnt != 4; ++cnt) {
+    threads.emplace_back([&pool] {
+      exe::runtime::BufferPool::ThreadCache cache(pool);
+      for (auto iter = 0; iter != 100'000; ++iter) {
+        auto first = pool.Acquire();
+        auto second = pool.Acquire();
+        first.Data()[0] = ::std::byte{1};
+        second.Data()[0] = ::std::byte{2};
+      }
+    });
+  }
+
+  for (auto &t : threads) {
+    t.join();
+  }
+
+  // Caches returned everything to the depot
+  ::std::vector<exe::runtime::Buffer> buffers;
+  while (auto buffer = pool.TryAcquire()) {
+    buffers.push_back(::std::move(buffer));
+  }
+  return buffers.size() == 64 * 16 ? EXIT_SUCCESS : EXIT_FAILURE;
+}
+
+int main() {
+  for (auto test : {TestBufferPoolLimits, TestBufferSharing,
+                    TestThreadCaches}) {
+    if (auto const res = test(); res != EXIT_SUCCESS) {
+      return res;
+    }
+  }
+  return EXIT_SUCCESS;
+}
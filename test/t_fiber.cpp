@@ -0,0 +1,115 @@
+//
+// t_fiber.cpp
+// ~~~~~~~~~~~
+//
+// Copyright (C) 2026 Artyom Kolpakov <ddvamp007@gmail.com>
+//
+// Licensed under GNU GPL-3.0-or-later.
+// See file LICENSE or <https://www.gnu.org/licenses/> for details.
+//
+
+#include <exe/fiber/api.hpp>
+#include <exe/runtime/manual_loop.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdlib>
+#include <new>
+#include <thread>
+#include <vector>
+
+namespace {
+
+::std::atomic_size_t allocations = 0;
+
+} // namespace
+
+[[gnu::noinline]] void *operator new(::std::size_t const size) {
+  allocations.fetch_add(1, ::std::memory_order_relaxed);
+  if (auto const ptr = ::std::malloc(size == 0 ? 1 : size)) {
+    return ptr;
+  }
+  throw ::std::bad_alloc();
+}
+
+[[gnu::noinline]] void operator delete(void *const ptr) noexcept {
+  ::std::free(ptr);
+}
+
+[[gnu::noinline]] void operator delete(void *const ptr, ::std::size_t)
+    noexcept {
+  ::std::free(ptr);
+}
+
+int TestSpawnWithoutHeap() {
+  exe::runtime::ManualLoop loop;
+  auto completed = 0;
+
+  auto const spawn = [&] {
+    for (auto cnt = 0; cnt != 100; ++cnt) {
+      exe::fiber::Go(loop, [&completed] noexcept {
+        exe::fiber::self::Yield();
+        ++completed;
+      }, exe::fiber::StackSize::k16K);
+    }
+    loop.Run();
+  };
+
+  // Fills the stack pool
+  spawn();
+
+  // The fiber lives on its stack, so spawning does not touch the heap
+  auto const before = allocations.load();
+  spawn();
+  auto const ok = completed == 200 && allocations.load() == before;
+  return ok ? EXIT_SUCCESS : EXIT_FAILURE;
+}
+
+int TestUniqueIds() {
+  constexpr auto kThreads = 4;
+  // More than a block of ids per thread
+  constexpr auto kFibers = 3000;
+
+  ::std::vector<::std::vector<exe::fiber::FiberId>> ids(kThreads);
+  for (auto &v : ids) {
+    v.reserve(kFibers);
+  }
+
+  ::std::vector<::std::thread> threads;
+  for (auto &v : ids) {
+    threads.emplace_back([&v] {
+      exe::runtime::ManualLoop loop;
+      for (auto cnt = 0; cnt != kFibers; ++cnt) {
+        exe::fiber::Go(loop, [&v] noexcept {
+          v.push_back(exe::fiber::self::GetId());
+        }, exe::fiber::StackSize::k16K);
+      }
+      loop.Run();
+    });
+  }
+
+  for (auto &t : threads) {
+    t.join();
+  }
+
+  ::std::vector<exe::fiber::FiberId> all;
+  for (auto const &v : ids) {
+    all.insert(all.end(), v.begin(), v.end());
+  }
+  ::std::ranges::sort(all);
+
+  auto const ok = all.size() == kThreads * kFibers &&
+                  ::std::ranges::adjacent_find(all) == all.end() &&
+                  all.back() != exe::fiber::kInvalidFiberId;
+  return ok ? EXIT_SUCCESS : EXIT_FAILURE;
+}
+
+int main() {
+  for (auto test : {TestSpawnWithoutHeap, TestUniqueIds}) {
+    if (auto const res = test(); res != EXIT_SUCCESS) {
+      return res;
+    }
+  }
+  return EXIT_SUCCESS;
+}
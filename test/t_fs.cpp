@@ -0,0 +1,143 @@
+//
+// t_fs.cpp
+// ~~~~~~~~
+//
+// Copyright (C) 2026 Artyom Kolpakov <ddvamp007@gmail.com>
+//
+// Licensed under GNU GPL-3.0-or-later.
+// See file LICENSE or <https://www.gnu.org/licenses/> for details.
+//
+
+#include <exe/fiber/api.hpp>
+#include <exe/fiber/fs/file.hpp>
+#include <exe/runtime/thread_pool.hpp>
+#include <exe/runtime/safe_scheduler.hpp>
+
+#include <concurrency/wait_group.hpp>
+
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/resource.h>
+
+#include <array>
+#include <atomic>
+#include <csignal>
+#include <cstddef>
+#include <cstdlib>
+#include <span>
+#include <system_error>
+
+namespace fs = exe::fiber::fs;
+
+int OpenTemp() {
+  char path[] = "/tmp/t_fs_XXXXXX";
+  auto const fd = ::mkstemp(path);
+  if (fd != -1) {
+    ::unlink(path);
+  }
+  return fd;
+}
+
+int TestReadWrite() {
+  exe::runtime::ThreadPool pool(2);
+  exe::runtime::SafeScheduler sched(pool);
+  concurrency::WaitGroup wg;
+
+  auto const fd = OpenTemp();
+  if (fd == -1) {
+    return EXIT_FAILURE;
+  }
+
+  constexpr auto kFibers = 8;
+  constexpr auto kChunk = 100;
+  ::std::atomic_int passed = 0;
+
+  pool.Start();
+  wg.Reset(kFibers);
+
+  for (auto idx = 0; idx != kFibers; ++idx) {
+    exe::fiber::Go(sched, [&, idx] noexcept {
+      ::std::array<char, kChunk> data;
+      data.fill(static_cast<char>('a' + idx));
+      auto const offset = static_cast<::off_t>(idx * kChunk);
+
+      auto const written = fs::Write(fd, ::std::as_bytes(::std::span(data)),
+                                     offset);
+      auto const synced = fs::Fsync(fd, true);
+
+      ::std::array<char, kChunk> back;
+      auto const out = ::std::as_writable_bytes(::std::span(back));
+      auto const read = fs::Read(fd, out, offset);
+      auto const failed = fs::Read(-1, out, 0);
+
+      if (written && *written == kChunk && !synced && read &&
+          *read == kChunk && back == data && !failed &&
+          failed.error() == ::std::errc::bad_file_descriptor) {
+        passed.fetch_add(1, ::std::memory_order_relaxed);
+      }
+      wg.Done();
+    });
+  }
+
+  wg.Wait();
+  pool.Stop();
+  ::close(fd);
+
+  return passed.load() == kFibers ? EXIT_SUCCESS : EXIT_FAILURE;
+}
+
+int TestPartialWrite() {
+  exe::runtime::ThreadPool pool(1);
+  exe::runtime::SafeScheduler sched(pool);
+  concurrency::WaitGroup wg;
+
+  auto const fd = OpenTemp();
+  if (fd == -1) {
+    return EXIT_FAILURE;
+  }
+
+  // Writes past the file size limit fail with EFBIG instead of the signal
+  ::std::signal(SIGXFSZ, SIG_IGN);
+  ::rlimit old_limit;
+  ::getrlimit(RLIMIT_FSIZE, &old_limit);
+  ::rlimit limit = {.rlim_cur = 150, .rlim_max = old_limit.rlim_max};
+  ::setrlimit(RLIMIT_FSIZE, &limit);
+
+  bool ok = false;
+
+  pool.Start();
+  wg.Reset(1);
+
+  exe::fiber::Go(sched, [&] noexcept {
+    ::std::array<char, 100> data;
+    data.fill('x');
+    auto const bytes = ::std::as_bytes(::std::span(data));
+
+    // Only 50 bytes fit, they are reported instead of the error
+    auto const first = fs::Write(fd, bytes, 100);
+    // The rest fails on the next call
+    auto const second = fs::Write(fd, bytes.subspan(50), 150);
+
+    ok = first && *first == 50 && !second &&
+         second.error() == ::std::errc::file_too_large;
+    wg.Done();
+  });
+
+  wg.Wait();
+  pool.Stop();
+  ::close(fd);
+
+  ::setrlimit(RLIMIT_FSIZE, &old_limit);
+  ::std::signal(SIGXFSZ, SIG_DFL);
+
+  return ok ? EXIT_SUCCESS : EXIT_FAILURE;
+}
+
+int main() {
+  for (auto test : {TestReadWrite, TestPartialWrite}) {
+    if (auto const res = test(); res != EXIT_SUCCESS) {
+      return res;
+    }
+  }
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,104 @@
+//
+// t_go_many.cpp
+// ~~~~~~~~~~~~~
+//
+// Copyright (C) 2026 Artyom Kolpakov <ddvamp007@gmail.com>
+//
+// Licensed under GNU GPL-3.0-or-later.
+// See file LICENSE or <https://www.gnu.org/licenses/> for details.
+//
+
+#include <exe/fiber/api.hpp>
+#include <exe/runtime/manual_loop.hpp>
+#include <exe/runtime/thread_pool.hpp>
+#include <exe/runtime/safe_scheduler.hpp>
+
+#include <concurrency/wait_group.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdlib>
+#include <stdexcept>
+#include <vector>
+
+int TestGoMany() {
+  exe::runtime::ThreadPool pool(4);
+  exe::runtime::SafeScheduler sched(pool);
+
+  pool.Start();
+
+  for (auto round = 0; round != 10; ++round) {
+    // Not a multiple of the internal batch
+    constexpr auto kFibers = 10'007uz;
+
+    concurrency::WaitGroup wg;
+    ::std::atomic_size_t sum = 0;
+    wg.Reset(kFibers);
+
+    exe::fiber::GoMany(sched, kFibers, [&](::std::size_t const idx) {
+      return exe::fiber::Body([&, idx] noexcept {
+        exe::fiber::self::Yield();
+        sum.fetch_add(idx, ::std::memory_order_relaxed);
+        wg.Done();
+      });
+    }, exe::fiber::StackSize::k16K);
+
+    wg.Wait();
+    if (sum != kFibers * (kFibers - 1) / 2) {
+      pool.Stop();
+      return EXIT_FAILURE;
+    }
+  }
+
+  pool.Stop();
+  return EXIT_SUCCESS;
+}
+
+int TestGoManyOrder() {
+  exe::runtime::ManualLoop loop;
+  ::std::vector<::std::size_t> order;
+
+  exe::fiber::GoMany(loop, 200, [&order](::std::size_t const idx) {
+    return exe::fiber::Body([&order, idx] noexcept {
+      order.push_back(idx);
+    });
+  });
+  loop.Run();
+
+  for (auto idx = 0uz; idx != 200; ++idx) {
+    if (order[idx] != idx) {
+      return EXIT_FAILURE;
+    }
+  }
+  return order.size() == 200 ? EXIT_SUCCESS : EXIT_FAILURE;
+}
+
+int TestGoManyThrowingFactory() {
+  exe::runtime::ManualLoop loop;
+  auto started = 0;
+  auto thrown = false;
+
+  try {
+    exe::fiber::GoMany(loop, 1000, [&started](::std::size_t const idx) {
+      if (idx == 100) {
+        throw ::std::runtime_error("factory");
+      }
+      return exe::fiber::Body([&started] noexcept { ++started; });
+    });
+  } catch (::std::runtime_error const &) {
+    thrown = true;
+  }
+
+  // The fibers created before the exception are started anyway
+  loop.Run();
+  return thrown && started == 100 ? EXIT_SUCCESS : EXIT_FAILURE;
+}
+
+int main() {
+  for (auto test : {TestGoMany, TestGoManyOrder, TestGoManyThrowingFactory}) {
+    if (auto const res = test(); res != EXIT_SUCCESS) {
+      return res;
+    }
+  }
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,127 @@
+//
+// t_handoff.cpp
+// ~~~~~~~~~~~~~
+//
+// Copyright (C) 2026 Artyom Kolpakov <ddvamp007@gmail.com>
+//
+// Licensed under GNU GPL-3.0-or-later.
+// See file LICENSE or <https://www.gnu.org/licenses/> for details.
+//
+
+#include <exe/fiber/api.hpp>
+#include <exe/fiber/sync/event.hpp>
+#include <exe/fiber/sync/wait_group.hpp>
+#include <exe/runtime/manual_loop.hpp>
+#include <exe/runtime/thread_pool.hpp>
+#include <exe/runtime/safe_scheduler.hpp>
+
+#include <concurrency/wait_group.hpp>
+
+#include <atomic>
+#include <cstdlib>
+#include <memory>
+#include <string>
+
+// Order in which the woken fiber and an already queued one run
+::std::string RunWakeOrder(bool const handoff) {
+  exe::runtime::ManualLoop loop;
+  exe::fiber::Event event;
+  ::std::string order;
+
+  exe::fiber::Go(loop, [&] noexcept {
+    event.Wait();
+    order += 'W';
+  });
+
+  exe::fiber::Go(loop, [&] noexcept {
+    exe::fiber::self::SetWakeHandoff(handoff);
+    exe::fiber::Go([&order] noexcept { order += 'Q'; });
+    event.Fire();
+    order += 'F';
+  });
+
+  loop.Run();
+  return order;
+}
+
+int TestWakeHandoff() {
+  // With handoff, the woken fiber runs as soon as the waker completes
+  auto const ok = RunWakeOrder(false) == "FQW" && RunWakeOrder(true) == "FWQ";
+  return ok ? EXIT_SUCCESS : EXIT_FAILURE;
+}
+
+int TestPingPong() {
+  exe::runtime::ThreadPool pool(4);
+  exe::runtime::SafeScheduler sched(pool);
+  concurrency::WaitGroup wg;
+
+  constexpr auto kRounds = 10'000;
+  auto const ping = ::std::make_unique<exe::fiber::Event[]>(kRounds);
+  auto const pong = ::std::make_unique<exe::fiber::Event[]>(kRounds);
+
+  pool.Start();
+  wg.Reset(2);
+
+  exe::fiber::Go(sched, [&] noexcept {
+    exe::fiber::self::SetWakeHandoff(true);
+    for (auto idx = 0; idx != kRounds; ++idx) {
+      ping[idx].Fire();
+      pong[idx].Wait();
+    }
+    wg.Done();
+  });
+
+  exe::fiber::Go(sched, [&] noexcept {
+    exe::fiber::self::SetWakeHandoff(true);
+    for (auto idx = 0; idx != kRounds; ++idx) {
+      ping[idx].Wait();
+      pong[idx].Fire();
+    }
+    wg.Done();
+  });
+
+  wg.Wait();
+  pool.Stop();
+  return EXIT_SUCCESS;
+}
+
+int TestManyWaiters() {
+  exe::runtime::ThreadPool pool(4);
+  exe::runtime::SafeScheduler sched(pool);
+  concurrency::WaitGroup done;
+
+  constexpr auto kWaiters = 1000;
+  exe::fiber::WaitGroup wg(1);
+  ::std::atomic_int woken = 0;
+
+  pool.Start();
+  done.Reset(kWaiters);
+
+  for (auto cnt = 0; cnt != kWaiters; ++cnt) {
+    exe::fiber::Go(sched, [&] noexcept {
+      wg.Wait();
+      woken.fetch_add(1, ::std::memory_order_relaxed);
+      done.Done();
+    }, exe::fiber::StackSize::k16K);
+  }
+
+  // Only the first waiter is handed off, the rest are scheduled
+  exe::fiber::Go(sched, [&] noexcept {
+    exe::fiber::self::SetWakeHandoff(true);
+    exe::fiber::self::Yield();
+    wg.Done();
+  });
+
+  done.Wait();
+  pool.Stop();
+  return woken == kWaiters ? EXIT_SUCCESS : EXIT_FAILURE;
+}
+
+int main() {
+  for (auto test : {TestWakeHandoff, TestPingPong, TestManyWaiters}) {
+    if (auto const res = test(); res != EXIT_SUCCESS) {
+      return res;
+    }
+  }
+  return EXIT_SUCCESS;
+}
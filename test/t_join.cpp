@@ -0,0 +1,170 @@
+//
+// t_join.cpp
+// ~~~~~~~~~~
+//
+// Copyright (C) 2026 Artyom Kolpakov <ddvamp007@gmail.com>
+//
+// Licensed under GNU GPL-3.0-or-later.
+// See file LICENSE or <https://www.gnu.org/licenses/> for details.
+//
+
+#include <exe/fiber/api.hpp>
+#include <exe/fiber/join.hpp>
+#include <exe/runtime/manual_loop.hpp>
+#include <exe/runtime/thread_pool.hpp>
+#include <exe/runtime/safe_scheduler.hpp>
+
+#include <concurrency/wait_group.hpp>
+
+#include <atomic>
+#include <cstdlib>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace {
+
+::std::atomic_int alive = 0;
+
+// Result that counts its live copies
+struct Tracked {
+  int value;
+
+  explicit Tracked(int const v) noexcept : value(v) {
+    alive.fetch_add(1, ::std::memory_order_relaxed);
+  }
+
+  Tracked(Tracked &&that) noexcept : value(that.value) {
+    alive.fetch_add(1, ::std::memory_order_relaxed);
+  }
+
+  ~Tracked() {
+    alive.fetch_sub(1, ::std::memory_order_relaxed);
+  }
+};
+
+} // namespace
+
+int TestJoin() {
+  exe::runtime::ManualLoop loop;
+  auto sum = 0;
+  auto alive_after_join = -1;
+
+  exe::fiber::Go(loop, [&] noexcept {
+    ::std::vector<exe::fiber::JoinHandle<int>> handles;
+    for (auto idx = 0; idx != 16; ++idx) {
+      handles.push_back(exe::fiber::Spawn([idx] noexcept {
+        if (idx % 2 != 0) {
+          exe::fiber::self::Yield();
+        }
+        return idx;
+      }));
+    }
+    for (auto &handle : handles) {
+      sum += handle.Join();
+      if (handle.IsValid()) {
+        sum = -1000;
+      }
+    }
+
+    {
+      auto const result = exe::fiber::Spawn([] noexcept {
+        return Tracked(42);
+      }).Join();
+      // The result of the fiber is destroyed by Join, only the copy is left
+      alive_after_join = alive.load();
+      sum += result.value;
+    }
+
+    exe::fiber::Spawn([] noexcept {}).Join();
+  });
+
+  loop.Run();
+
+  auto const ok = sum == 120 + 42 && alive_after_join == 1 && alive == 0;
+  return ok ? EXIT_SUCCESS : EXIT_FAILURE;
+}
+
+int TestDetach() {
+  exe::runtime::ManualLoop loop;
+  auto alive_running = -1;
+  auto alive_completed = -1;
+  auto alive_reassigned = -1;
+
+  exe::fiber::Go(loop, [&] noexcept {
+    // Detached before completion, the result is destroyed on completion
+    {
+      auto handle = exe::fiber::Spawn([] noexcept {
+        exe::fiber::self::Yield();
+        return Tracked(1);
+      });
+    }
+
+    // Completed before Detach, the result is destroyed by Detach
+    auto completed = exe::fiber::Spawn([] noexcept { return Tracked(2); });
+    exe::fiber::self::Yield();
+    exe::fiber::self::Yield();
+    alive_running = alive.load();
+    completed.Detach();
+    alive_completed = alive.load();
+
+    // Assignment detaches the previous fiber
+    auto handle = exe::fiber::Spawn([] noexcept { return Tracked(3); });
+    exe::fiber::self::Yield();
+    handle = exe::fiber::Spawn([] noexcept { return Tracked(4); });
+    exe::fiber::self::Yield();
+    alive_reassigned = alive.load();
+    handle.Detach();
+  });
+
+  loop.Run();
+
+  auto const ok = alive_running == 1 && alive_completed == 0 &&
+                  alive_reassigned == 1 && alive == 0;
+  return ok ? EXIT_SUCCESS : EXIT_FAILURE;
+}
+
+int TestJoinAcrossSchedulers() {
+  exe::runtime::ThreadPool first(1);
+  exe::runtime::ThreadPool second(1);
+  exe::runtime::SafeScheduler first_sched(first);
+  exe::runtime::SafeScheduler second_sched(second);
+  concurrency::WaitGroup wg;
+
+  auto ok = true;
+
+  first.Start();
+  second.Start();
+  wg.Reset(1);
+
+  exe::fiber::Go(first_sched, [&] noexcept {
+    for (auto iter = 0; iter != 1000; ++iter) {
+      auto handle = exe::fiber::Spawn(second_sched, [iter] noexcept {
+        if (iter % 2 != 0) {
+          exe::fiber::self::Yield();
+        }
+        return ::std::string(100, static_cast<char>('a' + iter % 26));
+      });
+      auto const str = handle.Join();
+      // Resumed on its own scheduler
+      ok = ok && &exe::fiber::self::GetScheduler() == &first_sched &&
+           str.size() == 100 && str[99] == 'a' + iter % 26;
+    }
+    wg.Done();
+  });
+
+  wg.Wait();
+  first.Stop();
+  second.Stop();
+
+  return ok ? EXIT_SUCCESS : EXIT_FAILURE;
+}
+
+int main() {
+  for (auto test : {TestJoin, TestDetach, TestJoinAcrossSchedulers}) {
+    if (auto const res = test(); res != EXIT_SUCCESS) {
+      return res;
+    }
+  }
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,141 @@
+//
+// t_local.cpp
+// ~~~~~~~~~~~
+//
+// Copyright (C) 2026 Artyom Kolpakov <ddvamp007@gmail.com>
+//
+// Licensed under GNU GPL-3.0-or-later.
+// See file LICENSE or <https://www.gnu.org/licenses/> for details.
+//
+
+#include <exe/fiber/api.hpp>
+#include <exe/fiber/local.hpp>
+#include <exe/runtime/manual_loop.hpp>
+#include <exe/runtime/thread_pool.hpp>
+#include <exe/runtime/safe_scheduler.hpp>
+
+#include <concurrency/wait_group.hpp>
+
+#include <atomic>
+#include <cstdlib>
+
+namespace {
+
+::std::atomic_int alive = 0;
+::std::atomic_int destroyed = 0;
+
+struct Tracked {
+  int value;
+
+  explicit Tracked(int const v = -1) noexcept : value(v) {
+    alive.fetch_add(1, ::std::memory_order_relaxed);
+  }
+
+  ~Tracked() {
+    alive.fetch_sub(1, ::std::memory_order_relaxed);
+    destroyed.fetch_add(1, ::std::memory_order_relaxed);
+  }
+};
+
+exe::fiber::FiberLocal<Tracked> tracked;
+exe::fiber::FiberLocal<int> counter;
+
+} // namespace
+
+int TestDestroyedOnCompletion() {
+  exe::runtime::ManualLoop loop;
+  destroyed = 0;
+
+  auto alive_inside = -1;
+  exe::fiber::Go(loop, [&] noexcept {
+    tracked.Get().value = 1;
+    exe::fiber::self::Yield();
+    alive_inside = alive.load();
+  });
+  loop.Run();
+  auto const destroyed_on_completion = destroyed == 1;
+
+  // Reuses the stack of the completed one, but starts without a value
+  auto inherited = true;
+  exe::fiber::Go(loop, [&] noexcept {
+    inherited = tracked.TryGet() || counter.TryGet();
+  });
+  loop.Run();
+
+  auto const ok = alive_inside == 1 && destroyed_on_completion && !inherited &&
+                  alive == 0;
+  return ok ? EXIT_SUCCESS : EXIT_FAILURE;
+}
+
+int TestResetAndEmplace() {
+  exe::runtime::ManualLoop loop;
+  destroyed = 0;
+
+  auto ok = false;
+  exe::fiber::Go(loop, [&] noexcept {
+    tracked.Emplace(1);
+    // The old value is destroyed before the new one is stored
+    auto const &second = tracked.Emplace(2);
+    auto const replaced = destroyed == 1 && alive == 1 &&
+                          tracked.TryGet() == &second && second.value == 2;
+
+    tracked.Reset();
+    auto const reset = destroyed == 2 && alive == 0 && !tracked.TryGet();
+
+    // Default-constructed on the first access
+    auto const recreated = tracked.Get().value == -1;
+    ok = replaced && reset && recreated;
+  });
+
+  loop.Run();
+
+  return ok && alive == 0 && destroyed == 3 ? EXIT_SUCCESS : EXIT_FAILURE;
+}
+
+int TestPerFiberValues() {
+  exe::runtime::ThreadPool pool(4);
+  exe::runtime::SafeScheduler sched(pool);
+  concurrency::WaitGroup wg;
+
+  constexpr auto kFibers = 1000;
+  ::std::atomic_int passed = 0;
+  destroyed = 0;
+
+  pool.Start();
+  wg.Reset(kFibers);
+
+  for (auto idx = 0; idx != kFibers; ++idx) {
+    exe::fiber::Go(sched, [&, idx] noexcept {
+      tracked.Get().value = idx;
+      auto ok = true;
+      for (auto iter = 0; iter != 10; ++iter) {
+        ++counter.Get();
+        exe::fiber::self::Yield();
+        ok = ok && tracked.Get().value == idx;
+      }
+      if (ok && counter.Get() == 10) {
+        passed.fetch_add(1, ::std::memory_order_relaxed);
+      }
+      if (idx % 2 != 0) {
+        tracked.Reset();
+      }
+      wg.Done();
+    }, exe::fiber::StackSize::k16K);
+  }
+
+  wg.Wait();
+  pool.Stop();
+
+  auto const ok = passed == kFibers && alive == 0 && destroyed == kFibers;
+  return ok ? EXIT_SUCCESS : EXIT_FAILURE;
+}
+
+int main() {
+  for (auto test : {TestDestroyedOnCompletion, TestResetAndEmplace,
+                    TestPerFiberValues}) {
+    if (auto const res = test(); res != EXIT_SUCCESS) {
+      return res;
+    }
+  }
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,135 @@
+//
+// t_mutex.cpp
+// ~~~~~~~~~~~
+//
+// Copyright (C) 2026 Artyom Kolpakov <ddvamp007@gmail.com>
+//
+// Licensed under GNU GPL-3.0-or-later.
+// See file LICENSE or <https://www.gnu.org/licenses/> for details.
+//
+
+#include <exe/fiber/api.hpp>
+#include <exe/fiber/sync/mutex.hpp>
+#include <exe/runtime/manual_loop.hpp>
+#include <exe/runtime/thread_pool.hpp>
+#include <exe/runtime/safe_scheduler.hpp>
+
+#include <concurrency/wait_group.hpp>
+
+#include <cstdlib>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+/**
+ *  Whether spinning pays off depends on the hold time and the number of
+ *  cores, so it is measured by benchmarks on a multicore machine. Here
+ *  the tests only check correctness and that spinning is not attempted
+ *  when the owner cannot run meanwhile
+ */
+
+int TestTryLockOutsideFiber() {
+  exe::fiber::Mutex mutex;
+
+  // The thread has not run any fiber yet
+  if (!mutex.TryLock() || mutex.TryLock()) {
+    return EXIT_FAILURE;
+  }
+  mutex.Unlock();
+
+  auto const ok = mutex.TryLock();
+  mutex.Unlock();
+  return ok ? EXIT_SUCCESS : EXIT_FAILURE;
+}
+
+int TestContention() {
+  // Two pools, so that fibers contend from different threads
+  exe::runtime::ThreadPool first(1);
+  exe::runtime::ThreadPool second(1);
+  exe::runtime::SafeScheduler first_sched(first);
+  exe::runtime::SafeScheduler second_sched(second);
+  concurrency::WaitGroup wg;
+
+  constexpr auto kFibers = 100;
+  constexpr auto kIters = 1000;
+  exe::fiber::Mutex mutex;
+  auto counter = 0;
+
+  auto const before = exe::fiber::GetMutexSpinStats();
+
+  first.Start();
+  second.Start();
+  wg.Reset(kFibers);
+
+  for (auto cnt = 0; cnt != kFibers; ++cnt) {
+    auto &sched = cnt % 2 == 0 ? first_sched : second_sched;
+    exe::fiber::Go(sched, [&] noexcept {
+      for (auto iter = 0; iter != kIters; ++iter) {
+        ::std::lock_guard lock(mutex);
+        ++counter;
+        if (iter % 100 == 0) {
+          exe::fiber::self::Yield();
+        }
+      }
+      wg.Done();
+    }, exe::fiber::StackSize::k16K);
+  }
+
+  wg.Wait();
+  second.Stop();
+  first.Stop();
+
+  auto const after = exe::fiber::GetMutexSpinStats();
+  auto const attempts = after.attempts - before.attempts;
+  auto const successes = after.successes - before.successes;
+
+  // With a single core, the owner never runs elsewhere
+  auto const spins_ok = successes <= attempts &&
+                        (::std::thread::hardware_concurrency() > 1 ||
+                         attempts == 0);
+  return counter == kFibers * kIters && spins_ok ? EXIT_SUCCESS
+                                                 : EXIT_FAILURE;
+}
+
+int TestRunMarkAfterThreadExit() {
+  constexpr auto kThreads = 100;
+  ::std::vector<exe::fiber::RunMark> marks;
+
+  // Threads come one by one, so each takes the counter of the previous one
+  for (auto cnt = 0; cnt != kThreads; ++cnt) {
+    ::std::thread([&marks] {
+      exe::runtime::ManualLoop loop;
+      exe::fiber::Go(loop, [&marks] noexcept {
+        marks.push_back(exe::fiber::self::GetRunMark());
+      });
+      loop.Run();
+    }).join();
+  }
+
+  auto ok = true;
+  for (auto idx = 1; idx != kThreads; ++idx) {
+    ok = ok && marks[idx].switches == marks[0].switches &&
+         marks[idx].epoch > marks[idx - 1].epoch;
+  }
+
+  // Marks of the exited threads stay readable and stale
+  exe::runtime::ManualLoop loop;
+  exe::fiber::Go(loop, [&] noexcept {
+    for (auto const mark : marks) {
+      ok = ok && !exe::fiber::self::IsRunningElsewhere(mark);
+    }
+  });
+  loop.Run();
+
+  return ok ? EXIT_SUCCESS : EXIT_FAILURE;
+}
+
+int main() {
+  for (auto test : {TestTryLockOutsideFiber, TestContention,
+                    TestRunMarkAfterThreadExit}) {
+    if (auto const res = test(); res != EXIT_SUCCESS) {
+      return res;
+    }
+  }
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,151 @@
+//
+// t_parking_lot.cpp
+// ~~~~~~~~~~~~~~~~~
+//
+// Copyright (C) 2026 Artyom Kolpakov <ddvamp007@gmail.com>
+//
+// Licensed under GNU GPL-3.0-or-later.
+// See file LICENSE or <https://www.gnu.org/licenses/> for details.
+//
+
+#include <exe/fiber/api.hpp>
+#include <exe/fiber/sync/parking_lot.hpp>
+#include <exe/runtime/manual_loop.hpp>
+#include <exe/runtime/thread_pool.hpp>
+#include <exe/runtime/safe_scheduler.hpp>
+
+#include <concurrency/wait_group.hpp>
+#include <util/macro.hpp>
+
+#include <atomic>
+#include <cstdlib>
+#include <string>
+#include <vector>
+
+int TestParkValidate() {
+  exe::runtime::ManualLoop loop;
+  int word = 0;
+  auto parked = true;
+
+  // The fiber does not suspend if validate fails
+  exe::fiber::Go(loop, [&] noexcept {
+    parked = exe::fiber::Park(&word, [&word] noexcept { return word != 0; });
+  });
+
+  return loop.Run() == 1 && !parked ? EXIT_SUCCESS : EXIT_FAILURE;
+}
+
+int TestUnparkOne() {
+  exe::runtime::ManualLoop loop;
+  int word = 0;
+  int other = 0;
+  ::std::string order;
+  ::std::vector<exe::fiber::UnparkResult> results;
+
+  for (auto const name : {'A', 'B', 'C'}) {
+    exe::fiber::Go(loop, [&, name] noexcept {
+      if (exe::fiber::Park(&word, [] noexcept { return true; })) {
+        order += name;
+      }
+    });
+  }
+  exe::fiber::Go(loop, [&] noexcept {
+    UTIL_IGNORE(exe::fiber::Park(&other, [] noexcept { return true; }));
+  });
+  loop.Run();
+
+  // Fibers parked on the address are unparked in FIFO order
+  for (auto cnt = 0; cnt != 4; ++cnt) {
+    auto const result =
+        exe::fiber::UnparkOne(&word, [&](auto const result) noexcept {
+          results.push_back(result);
+        });
+    if (result.unparked != results.back().unparked ||
+        result.has_more != results.back().has_more) {
+      return EXIT_FAILURE;
+    }
+    loop.Run();
+  }
+
+  // Fibers parked on another address are not affected
+  auto const unparked_other = exe::fiber::UnparkAll(&other);
+  loop.Run();
+
+  auto const ok = order == "ABC" && unparked_other == 1 &&
+                  results[0].unparked == 1 && results[0].has_more &&
+                  results[1].unparked == 1 && results[1].has_more &&
+                  results[2].unparked == 1 && !results[2].has_more &&
+                  results[3].unparked == 0 && !results[3].has_more;
+  return ok ? EXIT_SUCCESS : EXIT_FAILURE;
+}
+
+int TestUnparkAll() {
+  exe::runtime::ManualLoop loop;
+  int word = 0;
+  auto woken = 0;
+
+  for (auto cnt = 0; cnt != 10; ++cnt) {
+    exe::fiber::Go(loop, [&] noexcept {
+      if (exe::fiber::Park(&word, [] noexcept { return true; })) {
+        ++woken;
+      }
+    });
+  }
+  loop.Run();
+
+  auto const unparked = exe::fiber::UnparkAll(&word);
+  loop.Run();
+
+  auto const ok = unparked == 10 && woken == 10 &&
+                  exe::fiber::UnparkAll(&word) == 0;
+  return ok ? EXIT_SUCCESS : EXIT_FAILURE;
+}
+
+int TestValidateUnparkRace() {
+  // Two pools, so that parking and unparking threads run in parallel
+  exe::runtime::ThreadPool waiters(1);
+  exe::runtime::ThreadPool wakers(1);
+  exe::runtime::SafeScheduler waiters_sched(waiters);
+  exe::runtime::SafeScheduler wakers_sched(wakers);
+  concurrency::WaitGroup wg;
+
+  constexpr auto kRounds = 10'000;
+  ::std::vector<::std::atomic_int> words(kRounds);
+
+  waiters.Start();
+  wakers.Start();
+  wg.Reset(2 * kRounds);
+
+  // A missed unpark leaves a waiter parked forever, so the test hangs
+  for (auto idx = 0; idx != kRounds; ++idx) {
+    auto &word = words[idx];
+    exe::fiber::Go(waiters_sched, [&] noexcept {
+      while (word.load(::std::memory_order_acquire) == 0) {
+        UTIL_IGNORE(exe::fiber::Park(&word, [&word] noexcept {
+          return word.load(::std::memory_order_relaxed) == 0;
+        }));
+      }
+      wg.Done();
+    }, exe::fiber::StackSize::k16K);
+    exe::fiber::Go(wakers_sched, [&] noexcept {
+      word.store(1, ::std::memory_order_release);
+      UTIL_IGNORE(exe::fiber::UnparkAll(&word));
+      wg.Done();
+    }, exe::fiber::StackSize::k16K);
+  }
+
+  wg.Wait();
+  wakers.Stop();
+  waiters.Stop();
+  return EXIT_SUCCESS;
+}
+
+int main() {
+  for (auto test : {TestParkValidate, TestUnparkOne, TestUnparkAll,
+                    TestValidateUnparkRace}) {
+    if (auto const res = test(); res != EXIT_SUCCESS) {
+      return res;
+    }
+  }
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,119 @@
+//
+// t_priority.cpp
+// ~~~~~~~~~~~~~~
+//
+// Copyright (C) 2026 Artyom Kolpakov <ddvamp007@gmail.com>
+//
+// Licensed under GNU GPL-3.0-or-later.
+// See file LICENSE or <https://www.gnu.org/licenses/> for details.
+//
+
+#include <exe/fiber/api.hpp>
+#include <exe/runtime/task/priority.hpp>
+#include <exe/runtime/task/task.hpp>
+#include <exe/runtime/thread_pool.hpp>
+#include <exe/runtime/safe_scheduler.hpp>
+#include <exe/runtime/tp/queue.hpp>
+
+#include <concurrency/wait_group.hpp>
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdlib>
+#include <mutex>
+#include <thread>
+#include <utility>
+#include <vector>
+
+using exe::runtime::task::Priority;
+
+struct LevelTask final : exe::runtime::task::TaskBase {
+  Priority priority;
+
+  // exe::runtime::task::ITask
+  void Run() && noexcept override {}
+};
+
+int TestQueueFairness() {
+  exe::runtime::tp::Queue queue;
+
+  ::std::vector<LevelTask> high(1000);
+  ::std::vector<LevelTask> normal(100);
+  ::std::vector<LevelTask> low(100);
+  for (auto [tasks, priority] : {::std::pair{&high, Priority::kHigh},
+                                 ::std::pair{&normal, Priority::kNormal},
+                                 ::std::pair{&low, Priority::kLow}}) {
+    for (auto &task : *tasks) {
+      task.priority = priority;
+      queue.Push(task, priority);
+    }
+  }
+
+  // While high tasks are pending, both lower levels get fairness pops
+  ::std::array<::std::size_t, exe::runtime::task::kPriorityLevels> popped = {};
+  for (auto cnt = 0; cnt != 640; ++cnt) {
+    auto const task = static_cast<LevelTask *>(queue.TryPop());
+    ++popped[static_cast<::std::size_t>(task->priority)];
+  }
+
+  while (queue.TryPop()) {
+  }
+  queue.Close();
+
+  auto const ok = popped[0] == 630 && popped[1] == 5 && popped[2] == 5;
+  return ok ? EXIT_SUCCESS : EXIT_FAILURE;
+}
+
+int TestFiberPriority() {
+  exe::runtime::ThreadPool pool(1);
+  exe::runtime::SafeScheduler sched(pool);
+  concurrency::WaitGroup wg;
+
+  constexpr auto kFibers = 100;
+
+  ::std::mutex m;
+  ::std::vector<Priority> order;
+  ::std::atomic_bool blocked = true;
+
+  pool.Start();
+  wg.Reset(kFibers + 2);
+
+  // Holds the only worker, while the others are queued
+  exe::fiber::Go(sched, [&] noexcept {
+    while (blocked.load()) {
+      ::std::this_thread::yield();
+    }
+    wg.Done();
+  });
+
+  auto const body = [&] noexcept {
+    {
+      ::std::lock_guard lock(m);
+      order.push_back(exe::fiber::self::GetPriority());
+    }
+    wg.Done();
+  };
+
+  for (auto cnt = 0; cnt != kFibers; ++cnt) {
+    exe::fiber::Go(sched, body, Priority::kNormal);
+  }
+  exe::fiber::Go(sched, body, Priority::kHigh);
+
+  blocked.store(false);
+  wg.Wait();
+  pool.Stop();
+
+  auto const ok = order.size() == kFibers + 1 &&
+                  order.front() == Priority::kHigh;
+  return ok ? EXIT_SUCCESS : EXIT_FAILURE;
+}
+
+int main() {
+  for (auto test : {TestQueueFairness, TestFiberPriority}) {
+    if (auto const res = test(); res != EXIT_SUCCESS) {
+      return res;
+    }
+  }
+  return EXIT_SUCCESS;
+}
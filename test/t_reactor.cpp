@@ -8,15 +8,23 @@
 // See file LICENSE or <https://www.gnu.org/licenses/> for details.
 //
 
+#include <exe/runtime/manual_loop.hpp>
 #include <exe/runtime/reactor.hpp>
+#include <exe/runtime/timer_queue.hpp>
+#include <exe/runtime/task/submit.hpp>
+
+#include <util/macro.hpp>
 
 #include <unistd.h>
 #include <sys/timerfd.h>
 
 #include <cassert>
+#include <chrono>
 #include <cstdint>
 #include <cstdlib>
+#include <format>
 #include <iostream>
+#include <thread>
 
 class Timer : exe::runtime::Operation {
  private:
@@ -80,6 +88,178 @@ int TestReactor() {
   return EXIT_SUCCESS;
 }
 
+struct BusyPollResult {
+  int tasks;
+  exe::runtime::Reactor::Stats stats;
+};
+
+BusyPollResult RunTimerWithTasks(exe::runtime::Reactor::Clock::duration spin) {
+  exe::runtime::Reactor reactor;
+  reactor.Init(128);
+  reactor.SetBusyPoll(spin);
+
+  exe::runtime::ManualLoop loop;
+  auto tasks = 0;
+  for (auto cnt = 0; cnt != 1000; ++cnt) {
+    exe::runtime::task::Submit(loop, [&tasks] noexcept { ++tasks; });
+  }
+
+  Timer timer;
+  timer.Register(reactor);
+  timer.Arm();
+
+  reactor.Run(loop);
+  reactor.Close();
+
+  return {.tasks = tasks, .stats = reactor.GetStats()};
+}
+
+int TestBusyPollReactor() {
+  using namespace ::std::chrono_literals;
+
+  // The timer is rearmed every 10ms, so spinning for longer never blocks
+  auto const plain = RunTimerWithTasks(0ms);
+  auto const busy = RunTimerWithTasks(20ms);
+
+  auto const ok = plain.tasks == 1000 && busy.tasks == 1000 &&
+                  plain.stats.empty_polls == 0 &&
+                  busy.stats.empty_polls > 0 &&
+                  busy.stats.blocking_polls < plain.stats.blocking_polls;
+  return ok ? EXIT_SUCCESS : EXIT_FAILURE;
+}
+
+class Ticker : exe::runtime::TimerOperation {
+ private:
+  exe::runtime::Reactor &r_;
+  int times_ = 0;
+
+ public:
+  explicit Ticker(exe::runtime::Reactor &r) noexcept : r_(r) {}
+
+  [[nodiscard("Pure")]] int Times() const noexcept {
+    return times_;
+  }
+
+  void Arm() {
+    using namespace ::std::chrono_literals;
+    r_.AddTimer(*this, 1ms);
+  }
+
+  void Cancel() noexcept {
+    UTIL_IGNORE(r_.CancelTimer(*this));
+  }
+
+  // exe::runtime::TimerOperation
+  void OnTimer() noexcept override {
+    if (++times_ == 10) [[unlikely]] {
+      r_.Stop();
+      return;
+    }
+    Arm();
+  }
+};
+
+int TestReactorTimers() {
+  exe::runtime::Reactor reactor;
+  reactor.Init(128);
+
+  Ticker ticker(reactor);
+  ticker.Arm();
+
+  Ticker cancelled(reactor);
+  cancelled.Arm();
+  cancelled.Cancel();
+
+  auto const start = exe::runtime::Reactor::Clock::now();
+  reactor.Run();
+  reactor.Close();
+  auto const elapsed = exe::runtime::Reactor::Clock::now() - start;
+
+  ::std::cout << ::std::format("End {} in {}\n", ticker.Times(),
+      ::std::chrono::duration_cast<::std::chrono::microseconds>(elapsed));
+
+  using namespace ::std::chrono_literals;
+  auto const ok = ticker.Times() == 10 && cancelled.Times() == 0 &&
+                  elapsed >= 10ms;
+  return ok ? EXIT_SUCCESS : EXIT_FAILURE;
+}
+
+class Rearming : public exe::runtime::TimerOperation {
+ private:
+  exe::runtime::TimerQueue &q_;
+
+ public:
+  int times = 0;
+
+  explicit Rearming(exe::runtime::TimerQueue &q) noexcept : q_(q) {}
+
+  // exe::runtime::TimerOperation
+  void OnTimer() noexcept override {
+    ++times;
+    q_.Add(*this, GetDeadline());
+  }
+};
+
+int TestTimerRearmExpired() {
+  exe::runtime::TimerQueue queue;
+  Rearming timer(queue);
+  auto const now = exe::runtime::TimerQueue::Clock::now();
+  queue.Add(timer, now);
+
+  // Each call fires the timer once instead of spinning forever
+  auto const first = queue.FireExpired(now);
+  auto const second = queue.FireExpired(now);
+  UTIL_IGNORE(queue.Cancel(timer));
+
+  auto const ok = first == 1 && second == 1 && timer.times == 2;
+  return ok ? EXIT_SUCCESS : EXIT_FAILURE;
+}
+
+class Stopper : public exe::runtime::TimerOperation {
+ private:
+  exe::runtime::Reactor &r_;
+
+ public:
+  bool fired = false;
+
+  explicit Stopper(exe::runtime::Reactor &r) noexcept : r_(r) {}
+
+  // exe::runtime::TimerOperation
+  void OnTimer() noexcept override {
+    fired = true;
+    r_.Stop();
+  }
+};
+
+int TestReactorSubmitTimer() {
+  using namespace ::std::chrono_literals;
+
+  exe::runtime::Reactor reactor;
+  reactor.Init(128);
+
+  Stopper stopper(reactor);
+  auto const start = exe::runtime::Reactor::Clock::now();
+  ::std::thread submitter([&] {
+    ::std::this_thread::sleep_for(5ms);
+    reactor.SubmitTimer(stopper, exe::runtime::Reactor::Clock::now() + 5ms);
+  });
+
+  // Blocks with no timers until the submitter wakes it up
+  reactor.Run();
+  submitter.join();
+  reactor.Close();
+
+  auto const ok = stopper.fired &&
+                  exe::runtime::Reactor::Clock::now() - start >= 10ms;
+  return ok ? EXIT_SUCCESS : EXIT_FAILURE;
+}
+
 int main() {
-  return TestReactor();
+  for (auto test : {TestReactor, TestBusyPollReactor, TestReactorTimers,
+                    TestTimerRearmExpired, TestReactorSubmitTimer}) {
+    if (auto const res = test(); res != EXIT_SUCCESS) {
+      return res;
+    }
+  }
+  return EXIT_SUCCESS;
 }
@@ -0,0 +1,161 @@
+//
+// t_registration.cpp
+// ~~~~~~~~~~~~~~~~~~
+//
+// Copyright (C) 2026 Artyom Kolpakov <ddvamp007@gmail.com>
+//
+// Licensed under GNU GPL-3.0-or-later.
+// See file LICENSE or <https://www.gnu.org/licenses/> for details.
+//
+
+#include <exe/runtime/reactor.hpp>
+#include <exe/runtime/registration.hpp>
+
+#include <util/macro.hpp>
+
+#include <unistd.h>
+#include <sys/epoll.h>
+#include <sys/socket.h>
+
+#include <cstdint>
+#include <cstdlib>
+#include <system_error>
+
+using Mode = exe::runtime::Registration::Mode;
+
+// Answers every message of the peer until 100 round trips are done
+class Echo final : public exe::runtime::Registration {
+ private:
+  exe::runtime::Reactor &r_;
+
+ public:
+  int round_trips = 0;
+
+  Echo(exe::runtime::Reactor &r, int const fd) noexcept
+      : Registration(r, fd, Mode::kOneShot)
+      , r_(r) {}
+
+  // exe::runtime::Registration
+  void OnReady(::std::uint32_t const events) noexcept override {
+    char buf[16];
+    if (events & EPOLLIN) {
+      while (::read(GetFd(), buf, sizeof(buf)) > 0) {
+      }
+      // Interest changes are coalesced into a single rearm
+      UTIL_IGNORE(SetInterest(0));
+      UTIL_IGNORE(SetInterest(EPOLLOUT));
+    } else if (events & EPOLLOUT) {
+      UTIL_IGNORE(::write(GetFd(), "x", 1));
+      if (++round_trips == 100) {
+        r_.Stop();
+        UTIL_IGNORE(SetInterest(0));
+      } else {
+        UTIL_IGNORE(SetInterest(EPOLLIN));
+      }
+    }
+  }
+};
+
+class Peer final : public exe::runtime::Registration {
+ public:
+  Peer(exe::runtime::Reactor &r, int const fd) noexcept
+      : Registration(r, fd, Mode::kEdge) {}
+
+  // exe::runtime::Registration
+  void OnReady(::std::uint32_t) noexcept override {
+    char buf[16];
+    while (::read(GetFd(), buf, sizeof(buf)) > 0) {
+    }
+    UTIL_IGNORE(::write(GetFd(), "y", 1));
+  }
+};
+
+int TestRegistrationPingPong() {
+  exe::runtime::Reactor reactor;
+  reactor.Init(16);
+
+  int fds[2];
+  if (::socketpair(AF_UNIX, SOCK_STREAM | SOCK_NONBLOCK, 0, fds) != 0) {
+    return EXIT_FAILURE;
+  }
+
+  Echo echo(reactor, fds[0]);
+  Peer peer(reactor, fds[1]);
+  if (peer.SetInterest(EPOLLIN) || echo.SetInterest(EPOLLIN)) {
+    return EXIT_FAILURE;
+  }
+
+  UTIL_IGNORE(::write(fds[1], "y", 1));
+  reactor.Run();
+
+  auto const ok = echo.round_trips == 100 && !echo.Deregister() &&
+                  !peer.Deregister();
+
+  reactor.Close();
+  ::close(fds[0]);
+  ::close(fds[1]);
+
+  return ok ? EXIT_SUCCESS : EXIT_FAILURE;
+}
+
+// Closes its fd in OnReady, so the deferred rearm fails
+class Closing final : public exe::runtime::Registration {
+ private:
+  exe::runtime::Reactor &r_;
+
+ public:
+  int calls = 0;
+  ::std::uint32_t last_events = 0;
+  ::std::error_code error;
+
+  Closing(exe::runtime::Reactor &r, int const fd) noexcept
+      : Registration(r, fd, Mode::kOneShot)
+      , r_(r) {}
+
+  // exe::runtime::Registration
+  void OnReady(::std::uint32_t const events) noexcept override {
+    ++calls;
+    last_events = events;
+    if (events & EPOLLERR) {
+      error = SetInterest(0);
+      r_.Stop();
+    } else {
+      ::close(GetFd());
+    }
+  }
+};
+
+int TestRegistrationRearmError() {
+  exe::runtime::Reactor reactor;
+  reactor.Init(16);
+
+  int fds[2];
+  if (::socketpair(AF_UNIX, SOCK_STREAM | SOCK_NONBLOCK, 0, fds) != 0) {
+    return EXIT_FAILURE;
+  }
+
+  Closing closing(reactor, fds[0]);
+  if (closing.SetInterest(EPOLLIN)) {
+    return EXIT_FAILURE;
+  }
+
+  UTIL_IGNORE(::write(fds[1], "y", 1));
+  reactor.Run();
+
+  auto const ok = closing.calls == 2 && closing.last_events == EPOLLERR &&
+                  closing.error == ::std::errc::bad_file_descriptor;
+
+  reactor.Close();
+  ::close(fds[1]);
+
+  return ok ? EXIT_SUCCESS : EXIT_FAILURE;
+}
+
+int main() {
+  for (auto test : {TestRegistrationPingPong, TestRegistrationRearmError}) {
+    if (auto const res = test(); res != EXIT_SUCCESS) {
+      return res;
+    }
+  }
+  return EXIT_SUCCESS;
+}
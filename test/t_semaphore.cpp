@@ -0,0 +1,117 @@
+//
+// t_semaphore.cpp
+// ~~~~~~~~~~~~~~~
+//
+// Copyright (C) 2026 Artyom Kolpakov <ddvamp007@gmail.com>
+//
+// Licensed under GNU GPL-3.0-or-later.
+// See file LICENSE or <https://www.gnu.org/licenses/> for details.
+//
+
+#include <exe/fiber/api.hpp>
+#include <exe/fiber/sync/semaphore.hpp>
+#include <exe/runtime/manual_loop.hpp>
+#include <exe/runtime/thread_pool.hpp>
+#include <exe/runtime/safe_scheduler.hpp>
+
+#include <concurrency/wait_group.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <cstdlib>
+#include <string>
+
+int TestFifoHandoff() {
+  exe::runtime::ManualLoop loop;
+  exe::fiber::Semaphore semaphore(0);
+  ::std::string order;
+
+  exe::fiber::Go(loop, [&] noexcept {
+    semaphore.Acquire(2);
+    order += 'A';
+  });
+  for (auto const name : {'B', 'C'}) {
+    exe::fiber::Go(loop, [&, name] noexcept {
+      semaphore.Acquire();
+      order += name;
+    });
+  }
+  loop.Run();
+
+  // The head waiter needs more, and newcomers cannot barge in
+  semaphore.Release();
+  loop.Run();
+  if (!order.empty() || semaphore.TryAcquire()) {
+    return EXIT_FAILURE;
+  }
+
+  semaphore.Release();
+  loop.Run();
+  if (order != "A") {
+    return EXIT_FAILURE;
+  }
+
+  // Permits are handed to the waiters, none are left
+  semaphore.Release(2);
+  loop.Run();
+  if (order != "ABC" || semaphore.TryAcquire()) {
+    return EXIT_FAILURE;
+  }
+
+  semaphore.Release();
+  return semaphore.TryAcquire() ? EXIT_SUCCESS : EXIT_FAILURE;
+}
+
+int TestGuardLimitsConcurrency() {
+  // Two pools, so that fibers contend from different threads
+  exe::runtime::ThreadPool first(1);
+  exe::runtime::ThreadPool second(1);
+  exe::runtime::SafeScheduler first_sched(first);
+  exe::runtime::SafeScheduler second_sched(second);
+  concurrency::WaitGroup wg;
+
+  constexpr auto kLimit = 3;
+  constexpr auto kFibers = 1000;
+  exe::fiber::Semaphore semaphore(kLimit);
+  ::std::atomic_int inside = 0;
+  ::std::atomic_int max_inside = 0;
+
+  first.Start();
+  second.Start();
+  wg.Reset(kFibers);
+
+  for (auto cnt = 0; cnt != kFibers; ++cnt) {
+    auto &sched = cnt % 2 == 0 ? first_sched : second_sched;
+    exe::fiber::Go(sched, [&] noexcept {
+      for (auto iter = 0; iter != 10; ++iter) {
+        exe::fiber::SemaphoreGuard guard(semaphore);
+        auto const now = inside.fetch_add(1, ::std::memory_order_relaxed) + 1;
+        auto max = max_inside.load(::std::memory_order_relaxed);
+        while (max < now && !max_inside.compare_exchange_weak(
+                                max, now, ::std::memory_order_relaxed)) {
+        }
+        exe::fiber::self::Yield();
+        inside.fetch_sub(1, ::std::memory_order_relaxed);
+      }
+      wg.Done();
+    }, exe::fiber::StackSize::k16K);
+  }
+
+  wg.Wait();
+  second.Stop();
+  first.Stop();
+
+  // All permits are back
+  auto const ok = max_inside <= kLimit && semaphore.TryAcquire(kLimit) &&
+                  !semaphore.TryAcquire();
+  return ok ? EXIT_SUCCESS : EXIT_FAILURE;
+}
+
+int main() {
+  for (auto test : {TestFifoHandoff, TestGuardLimitsConcurrency}) {
+    if (auto const res = test(); res != EXIT_SUCCESS) {
+      return res;
+    }
+  }
+  return EXIT_SUCCESS;
+}
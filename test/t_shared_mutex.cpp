@@ -0,0 +1,153 @@
+//
+// t_shared_mutex.cpp
+// ~~~~~~~~~~~~~~~~~~
+//
+// Copyright (C) 2026 Artyom Kolpakov <ddvamp007@gmail.com>
+//
+// Licensed under GNU GPL-3.0-or-later.
+// See file LICENSE or <https://www.gnu.org/licenses/> for details.
+//
+
+#include <exe/fiber/api.hpp>
+#include <exe/fiber/sync/shared_mutex.hpp>
+#include <exe/runtime/manual_loop.hpp>
+#include <exe/runtime/thread_pool.hpp>
+#include <exe/runtime/safe_scheduler.hpp>
+
+#include <concurrency/wait_group.hpp>
+
+#include <atomic>
+#include <cstdlib>
+#include <mutex>
+#include <shared_mutex>
+#include <string>
+
+int TestSharedOwnership() {
+  exe::fiber::SharedMutex mutex;
+
+  if (!mutex.TryLockShared() || !mutex.TryLockShared() || mutex.TryLock()) {
+    return EXIT_FAILURE;
+  }
+  mutex.UnlockShared();
+  mutex.UnlockShared();
+
+  if (!mutex.TryLock() || mutex.TryLockShared() || mutex.TryLock()) {
+    return EXIT_FAILURE;
+  }
+  mutex.Unlock();
+  return EXIT_SUCCESS;
+}
+
+int TestWriterPreferred() {
+  exe::runtime::ManualLoop loop;
+  exe::fiber::SharedMutex mutex;
+  ::std::string order;
+
+  exe::fiber::Go(loop, [&] noexcept {
+    ::std::shared_lock lock(mutex);
+    exe::fiber::self::Yield();
+    exe::fiber::self::Yield();
+    order += 'R';
+  });
+  exe::fiber::Go(loop, [&] noexcept {
+    ::std::lock_guard lock(mutex);
+    order += 'W';
+  });
+
+  // A new reader waits behind the waiting writer
+  exe::fiber::Go(loop, [&] noexcept {
+    ::std::shared_lock lock(mutex);
+    order += 'r';
+  });
+
+  loop.Run();
+  return order == "RWr" ? EXIT_SUCCESS : EXIT_FAILURE;
+}
+
+int TestUnlockingWriterWakesWriter() {
+  exe::runtime::ManualLoop loop;
+  exe::fiber::SharedMutex mutex;
+  ::std::string order;
+
+  exe::fiber::Go(loop, [&] noexcept {
+    ::std::lock_guard lock(mutex);
+    exe::fiber::self::Yield();
+    exe::fiber::self::Yield();
+    order += 'A';
+  });
+  exe::fiber::Go(loop, [&] noexcept {
+    ::std::shared_lock lock(mutex);
+    order += 'r';
+  });
+  exe::fiber::Go(loop, [&] noexcept {
+    ::std::lock_guard lock(mutex);
+    order += 'B';
+  });
+
+  // The reader queued before the second writer is still woken after it
+  loop.Run();
+  return order == "ABr" ? EXIT_SUCCESS : EXIT_FAILURE;
+}
+
+int TestContention() {
+  // Two pools, so that fibers contend from different threads
+  exe::runtime::ThreadPool first(1);
+  exe::runtime::ThreadPool second(1);
+  exe::runtime::SafeScheduler first_sched(first);
+  exe::runtime::SafeScheduler second_sched(second);
+  concurrency::WaitGroup wg;
+
+  constexpr auto kRounds = 100;
+  constexpr auto kFibers = 20;
+  ::std::atomic_bool ok = true;
+
+  first.Start();
+  second.Start();
+
+  for (auto round = 0; round != kRounds; ++round) {
+    // Destroyed each round, with waiting flags possibly left behind
+    exe::fiber::SharedMutex mutex;
+    auto x = 0;
+    auto y = 0;
+
+    wg.Reset(kFibers);
+    for (auto cnt = 0; cnt != kFibers; ++cnt) {
+      auto &sched = cnt % 2 == 0 ? first_sched : second_sched;
+      exe::fiber::Go(sched, [&, cnt] noexcept {
+        for (auto iter = 0; iter != 100; ++iter) {
+          if ((cnt + iter) % 4 == 0) {
+            ::std::lock_guard lock(mutex);
+            ++x;
+            exe::fiber::self::Yield();
+            ++y;
+          } else {
+            ::std::shared_lock lock(mutex);
+            if (x != y) {
+              ok = false;
+            }
+          }
+        }
+        wg.Done();
+      }, exe::fiber::StackSize::k16K);
+    }
+    wg.Wait();
+
+    if (x != kFibers * 100 / 4 || x != y) {
+      ok = false;
+    }
+  }
+
+  second.Stop();
+  first.Stop();
+  return ok ? EXIT_SUCCESS : EXIT_FAILURE;
+}
+
+int main() {
+  for (auto test : {TestSharedOwnership, TestWriterPreferred,
+                    TestUnlockingWriterWakesWriter, TestContention}) {
+    if (auto const res = test(); res != EXIT_SUCCESS) {
+      return res;
+    }
+  }
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,135 @@
+//
+// t_signal.cpp
+// ~~~~~~~~~~~~
+//
+// Copyright (C) 2026 Artyom Kolpakov <ddvamp007@gmail.com>
+//
+// Licensed under GNU GPL-3.0-or-later.
+// See file LICENSE or <https://www.gnu.org/licenses/> for details.
+//
+
+#include <exe/runtime/reactor.hpp>
+#include <exe/runtime/signal.hpp>
+
+#include <pthread.h>
+#include <signal.h>
+#include <unistd.h>
+#include <sys/wait.h>
+
+#include <cstdlib>
+#include <system_error>
+
+class Signals final : public exe::runtime::SignalOperation {
+ private:
+  exe::runtime::Reactor &r_;
+
+ public:
+  int terms = 0;
+  int hups = 0;
+
+  explicit Signals(exe::runtime::Reactor &r) noexcept : r_(r) {}
+
+  // exe::runtime::SignalOperation
+  void OnSignal(::signalfd_siginfo const &info) noexcept override {
+    if (info.ssi_signo == SIGTERM) {
+      ++terms;
+    } else if (info.ssi_signo == SIGHUP) {
+      ++hups;
+      r_.Stop();
+    }
+  }
+};
+
+class Child final : public exe::runtime::ProcessExitOperation {
+ public:
+  ::siginfo_t info = {};
+  ::std::error_code error;
+  bool exited = false;
+
+  // exe::runtime::ProcessExitOperation
+  void OnExit(::siginfo_t const &i, ::std::error_code ec) noexcept override {
+    info = i;
+    error = ec;
+    exited = true;
+    // Ends the test after the exit
+    ::kill(::getpid(), SIGHUP);
+  }
+};
+
+int TestSignalsAndExit() {
+  exe::runtime::Reactor reactor;
+  reactor.Init(16);
+
+  Signals signals(reactor);
+  signals.Init(reactor, {SIGTERM, SIGHUP});
+
+  auto const pid = ::fork();
+  if (pid == 0) {
+    ::usleep(20'000);
+    ::_exit(7);
+  }
+
+  Child child;
+  child.Init(reactor, pid);
+  ::kill(::getpid(), SIGTERM);
+
+  reactor.Run();
+  signals.Close();
+  reactor.Close();
+
+  auto const ok = signals.terms == 1 && signals.hups == 1 && child.exited &&
+                  !child.error && child.info.si_code == CLD_EXITED &&
+                  child.info.si_status == 7;
+  return ok ? EXIT_SUCCESS : EXIT_FAILURE;
+}
+
+int TestReapedElsewhere() {
+  exe::runtime::Reactor reactor;
+  reactor.Init(16);
+
+  Signals signals(reactor);
+  signals.Init(reactor, {SIGHUP});
+
+  auto const pid = ::fork();
+  if (pid == 0) {
+    ::_exit(0);
+  }
+
+  Child child;
+  child.Init(reactor, pid);
+  ::waitpid(pid, nullptr, 0);
+
+  reactor.Run();
+  signals.Close();
+  reactor.Close();
+
+  auto const ok = child.exited && child.error == ::std::errc::no_child_process;
+  return ok ? EXIT_SUCCESS : EXIT_FAILURE;
+}
+
+int TestInitFailureUnblocks() {
+  // Not initialized, so the signalfd cannot be added
+  exe::runtime::Reactor reactor;
+  Signals signals(reactor);
+
+  try {
+    signals.Init(reactor, {SIGUSR2});
+    return EXIT_FAILURE;
+  } catch (::std::system_error const &) {
+  }
+
+  // The signal is not left blocked
+  ::sigset_t mask;
+  ::pthread_sigmask(SIG_BLOCK, nullptr, &mask);
+  return ::sigismember(&mask, SIGUSR2) ? EXIT_FAILURE : EXIT_SUCCESS;
+}
+
+int main() {
+  for (auto test : {TestSignalsAndExit, TestReapedElsewhere,
+                    TestInitFailureUnblocks}) {
+    if (auto const res = test(); res != EXIT_SUCCESS) {
+      return res;
+    }
+  }
+  return EXIT_SUCCESS;
+}
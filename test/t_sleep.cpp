@@ -0,0 +1,100 @@
+//
+// t_sleep.cpp
+// ~~~~~~~~~~~
+//
+// Copyright (C) 2026 Artyom Kolpakov <ddvamp007@gmail.com>
+//
+// Licensed under GNU GPL-3.0-or-later.
+// See file LICENSE or <https://www.gnu.org/licenses/> for details.
+//
+
+#include <exe/fiber/api.hpp>
+#include <exe/runtime/manual_loop.hpp>
+#include <exe/runtime/thread_pool.hpp>
+#include <exe/runtime/safe_scheduler.hpp>
+
+#include <concurrency/wait_group.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <thread>
+
+using Clock = ::std::chrono::steady_clock;
+using namespace ::std::chrono_literals;
+
+int TestSleepFor() {
+  exe::runtime::ThreadPool pool(4);
+  exe::runtime::SafeScheduler sched(pool);
+  concurrency::WaitGroup wg;
+
+  constexpr auto kFibers = 2000;
+  ::std::atomic_int early = 0;
+
+  pool.Start();
+  wg.Reset(kFibers);
+
+  auto const start = Clock::now();
+  for (auto idx = 0; idx != kFibers; ++idx) {
+    exe::fiber::Go(sched, [&, idx] noexcept {
+      auto const duration = ::std::chrono::milliseconds(10 + idx % 50);
+      auto const begin = Clock::now();
+      exe::fiber::self::SleepFor(duration);
+      if (Clock::now() - begin < duration) {
+        early.fetch_add(1, ::std::memory_order_relaxed);
+      }
+      wg.Done();
+    }, exe::fiber::StackSize::k16K);
+  }
+
+  wg.Wait();
+  auto const elapsed = Clock::now() - start;
+  pool.Stop();
+
+  // Sleeping fibers do not block the workers
+  auto const ok = early == 0 && elapsed < 2s;
+  return ok ? EXIT_SUCCESS : EXIT_FAILURE;
+}
+
+int TestSleepUntilPast() {
+  exe::runtime::ManualLoop loop;
+  auto done = false;
+
+  exe::fiber::Go(loop, [&done] noexcept {
+    exe::fiber::self::SleepUntil(Clock::now() - 1s);
+    exe::fiber::self::SleepFor(-1s);
+    exe::fiber::self::SleepFor(Clock::duration::zero());
+    done = true;
+  });
+
+  // Does not suspend at all
+  loop.Run();
+  return done ? EXIT_SUCCESS : EXIT_FAILURE;
+}
+
+int TestSleepForever() {
+  exe::runtime::ManualLoop loop;
+  ::std::atomic_bool woken = false;
+
+  // The deadline saturates instead of wrapping around into the past.
+  // The fiber is never woken up and stays suspended until exit
+  exe::fiber::Go(loop, [&woken] noexcept {
+    exe::fiber::self::SleepFor(Clock::duration::max());
+    woken = true;
+  });
+
+  loop.Run();
+  ::std::this_thread::sleep_for(50ms);
+  loop.Run();
+
+  return woken ? EXIT_FAILURE : EXIT_SUCCESS;
+}
+
+int main() {
+  for (auto test : {TestSleepFor, TestSleepUntilPast, TestSleepForever}) {
+    if (auto const res = test(); res != EXIT_SUCCESS) {
+      return res;
+    }
+  }
+  return EXIT_SUCCESS;
+}
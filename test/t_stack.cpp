@@ -0,0 +1,191 @@
+//
+// t_stack.cpp
+// ~~~~~~~~~~~
+//
+// Copyright (C) 2026 Artyom Kolpakov <ddvamp007@gmail.com>
+//
+// Licensed under GNU GPL-3.0-or-later.
+// See file LICENSE or <https://www.gnu.org/licenses/> for details.
+//
+
+#include <exe/fiber/api.hpp>
+#include <exe/fiber/core/stack.hpp>
+#include <exe/runtime/manual_loop.hpp>
+
+#include <sys/mman.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdlib>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace fiber = exe::fiber;
+
+int TestMagazineReuse() {
+  auto ok = false;
+
+  // Fresh thread, so that the magazine starts empty
+  ::std::thread([&ok] {
+    auto stack = fiber::AllocateStack(fiber::StackSize::k64K);
+    auto const memory = stack.Memory();
+    fiber::DeallocateStack(::std::move(stack));
+
+    // The last freed stack is reused first
+    auto again = fiber::AllocateStack(fiber::StackSize::k64K);
+    ok = again.Memory() == memory;
+    fiber::DeallocateStack(::std::move(again));
+  }).join();
+
+  return ok ? EXIT_SUCCESS : EXIT_FAILURE;
+}
+
+int TestAllocateStacks() {
+  constexpr auto kCount = 100;
+
+  ::std::vector<fiber::Stack> stacks(kCount);
+  fiber::AllocateStacks(fiber::StackSize::k16K, stacks);
+
+  ::std::vector<::std::byte *> memory;
+  for (auto &stack : stacks) {
+    memory.push_back(stack.Memory());
+  }
+  ::std::ranges::sort(memory);
+  auto const unique = ::std::ranges::adjacent_find(memory) == memory.end();
+
+  for (auto &stack : stacks) {
+    fiber::DeallocateStack(::std::move(stack));
+  }
+
+  return unique ? EXIT_SUCCESS : EXIT_FAILURE;
+}
+
+int TestMagazinesConcurrently() {
+  ::std::vector<::std::thread> threads;
+  for (auto cnt = 0; cnt != 4; ++cnt) {
+    threads.emplace_back([] {
+      // Overflow the magazine, so that stacks go through the depot
+      ::std::array<fiber::Stack, 40> stacks;
+      for (auto iter = 0; iter != 1000; ++iter) {
+        for (auto &stack : stacks) {
+          stack = fiber::AllocateStack(fiber::StackSize::k16K);
+          stack.Memory()[0] = ::std::byte{1};
+        }
+        for (auto &stack : stacks) {
+          fiber::DeallocateStack(::std::move(stack));
+        }
+      }
+    });
+  }
+
+  for (auto &t : threads) {
+    t.join();
+  }
+  return EXIT_SUCCESS;
+}
+
+int TestSizeClasses() {
+  for (auto idx = 0uz; idx != fiber::kStackSizeClasses; ++idx) {
+    auto const size = static_cast<fiber::StackSize>(idx);
+    auto stack = fiber::AllocateStack(size);
+    // Plus the guard page
+    auto const bytes = stack.View().size();
+    fiber::DeallocateStack(::std::move(stack));
+
+    if (bytes <= fiber::StackBytes(size) ||
+        bytes > 2 * fiber::StackBytes(size)) {
+      return EXIT_FAILURE;
+    }
+  }
+
+  auto const old = fiber::GetDefaultStackSize();
+  fiber::SetDefaultStackSize(fiber::StackSize::k16K);
+  auto stack = fiber::AllocateStack();
+  auto const bytes = stack.View().size();
+  fiber::DeallocateStack(::std::move(stack));
+  fiber::SetDefaultStackSize(old);
+
+  return bytes < fiber::StackBytes(fiber::StackSize::k64K) ? EXIT_SUCCESS
+                                                           : EXIT_FAILURE;
+}
+
+int TestFibersOfAllSizes() {
+  exe::runtime::ManualLoop loop;
+  auto completed = 0uz;
+
+  for (auto idx = 0uz; idx != fiber::kStackSizeClasses; ++idx) {
+    for (auto cnt = 0; cnt != 100; ++cnt) {
+      fiber::Go(loop, [&completed] noexcept {
+        fiber::self::Yield();
+        ++completed;
+      }, static_cast<fiber::StackSize>(idx));
+    }
+  }
+
+  loop.Run();
+  return completed == 100 * fiber::kStackSizeClasses ? EXIT_SUCCESS
+                                                     : EXIT_FAILURE;
+}
+
+int TestForeignSizedStack() {
+  // Fits no size class, so it is released rather than pooled
+  auto stack = fiber::Stack::AllocateBytes(100 * 1024);
+  fiber::DeallocateStack(::std::move(stack));
+
+  auto reused = fiber::AllocateStack(fiber::StackSize::k64K);
+  auto const ok = reused.View().size() >= fiber::StackBytes(
+                                              fiber::StackSize::k64K) &&
+                  reused.View().size() < 100 * 1024;
+  fiber::DeallocateStack(::std::move(reused));
+  return ok ? EXIT_SUCCESS : EXIT_FAILURE;
+}
+
+[[nodiscard]] bool IsResident(::std::byte *const page) {
+  unsigned char resident = 0;
+  return ::mincore(page, 1, &resident) == 0 && (resident & 1);
+}
+
+int TestTrimParkedStacks() {
+  auto ok = false;
+
+  ::std::thread([&ok] {
+    constexpr auto kSize = fiber::StackSize::k1M;
+    auto const page = static_cast<::std::size_t>(::sysconf(_SC_PAGESIZE));
+
+    ::std::array<fiber::Stack, 8> stacks;
+    for (auto &stack : stacks) {
+      stack = fiber::AllocateStack(kSize);
+    }
+
+    // A deep fiber used the whole stack
+    auto const view = stacks[0].View();
+    auto const memory = stacks[0].Memory();
+    ::std::ranges::fill(memory, view.data() + view.size(), ::std::byte{1});
+    auto const middle = memory + (view.size() / 2) / page * page;
+    auto const touched = IsResident(middle);
+
+    // Then it sinks below the recently freed ones
+    for (auto &stack : stacks) {
+      fiber::DeallocateStack(::std::move(stack));
+    }
+
+    ok = touched && !IsResident(middle);
+  }).join();
+
+  return ok ? EXIT_SUCCESS : EXIT_FAILURE;
+}
+
+int main() {
+  for (auto test : {TestMagazineReuse, TestAllocateStacks,
+                    TestMagazinesConcurrently, TestSizeClasses,
+                    TestFibersOfAllSizes, TestForeignSizedStack,
+                    TestTrimParkedStacks}) {
+    if (auto const res = test(); res != EXIT_SUCCESS) {
+      return res;
+    }
+  }
+  return EXIT_SUCCESS;
+}
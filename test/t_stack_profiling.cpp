@@ -0,0 +1,68 @@
+//
+// t_stack_profiling.cpp
+// ~~~~~~~~~~~~~~~~~~~~~
+//
+// Copyright (C) 2026 Artyom Kolpakov <ddvamp007@gmail.com>
+//
+// Licensed under GNU GPL-3.0-or-later.
+// See file LICENSE or <https://www.gnu.org/licenses/> for details.
+//
+
+#include <exe/fiber/api.hpp>
+#include <exe/fiber/core/stack.hpp>
+#include <exe/runtime/manual_loop.hpp>
+
+#include <cstdlib>
+#include <cstring>
+#include <format>
+#include <iostream>
+
+namespace fiber = exe::fiber;
+
+[[gnu::noinline]] void Deep(int const depth) {
+  char buf[1024];
+  ::std::memset(buf, depth, sizeof(buf));
+  asm volatile("" : : "r"(buf) : "memory");
+  if (depth != 0) {
+    Deep(depth - 1);
+  }
+  // Not a tail call, so that frames pile up
+  asm volatile("" : : "r"(buf) : "memory");
+}
+
+int TestStackProfiling() {
+  // Before any fiber is created
+  fiber::EnableStackProfiling();
+
+  exe::runtime::ManualLoop loop;
+  constexpr auto kFibers = 300;
+
+  for (auto idx = 0; idx != kFibers; ++idx) {
+    fiber::Go(loop, [idx] noexcept {
+      // Every third fiber uses more than 100K
+      Deep(idx % 3 == 0 ? 100 : 2);
+    }, fiber::StackSize::k256K);
+  }
+  loop.Run();
+
+  auto const usage = fiber::GetStackUsage(fiber::StackSize::k256K);
+  ::std::cout << ::std::format("samples: {}, max: {}\n", usage.samples,
+                               usage.max_bytes);
+
+  auto shallow = 0uz;
+  auto deep = 0uz;
+  for (auto idx = 0uz; idx != fiber::StackUsage::kBuckets; ++idx) {
+    auto const limit = fiber::StackUsage::BucketLimit(idx);
+    (limit <= 16 * 1024 ? shallow : deep) += usage.histogram[idx];
+  }
+
+  auto const ok = usage.samples == kFibers && shallow == 2 * kFibers / 3 &&
+                  deep == kFibers / 3 && usage.max_bytes > 100 * 1024 &&
+                  usage.max_bytes < 256 * 1024 &&
+                  fiber::GetStackUsage(fiber::StackSize::k16K).samples == 0;
+  return ok ? EXIT_SUCCESS : EXIT_FAILURE;
+}
+
+int main() {
+  return TestStackProfiling();
+}
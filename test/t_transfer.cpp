@@ -0,0 +1,120 @@
+//
+// t_transfer.cpp
+// ~~~~~~~~~~~~~~
+//
+// Copyright (C) 2026 Artyom Kolpakov <ddvamp007@gmail.com>
+//
+// Licensed under GNU GPL-3.0-or-later.
+// See file LICENSE or <https://www.gnu.org/licenses/> for details.
+//
+
+#include <exe/fiber/api.hpp>
+#include <exe/fiber/io/transfer.hpp>
+#include <exe/fiber/io/wait.hpp>
+#include <exe/runtime/manual_loop.hpp>
+#include <exe/runtime/reactor.hpp>
+
+#include <unistd.h>
+#include <sys/socket.h>
+
+#include <cstddef>
+#include <cstdlib>
+#include <format>
+#include <iostream>
+#include <vector>
+
+int TestSendFileSplice() {
+  // Larger than socket buffers, so that both transfers have to wait
+  constexpr ::std::size_t kSize = 3 << 20;
+
+  ::std::vector<char> data(kSize);
+  for (::std::size_t i = 0; i != kSize; ++i) {
+    data[i] = static_cast<char>(i * 7);
+  }
+
+  char path[] = "/tmp/t_transfer_XXXXXX";
+  auto const file = ::mkstemp(path);
+  if (file == -1) {
+    return EXIT_FAILURE;
+  }
+  ::unlink(path);
+  if (::write(file, data.data(), kSize) != static_cast<::ssize_t>(kSize)) {
+    return EXIT_FAILURE;
+  }
+
+  int first[2];
+  int second[2];
+  if (::socketpair(AF_UNIX, SOCK_STREAM | SOCK_NONBLOCK, 0, first) != 0 ||
+      ::socketpair(AF_UNIX, SOCK_STREAM | SOCK_NONBLOCK, 0, second) != 0) {
+    return EXIT_FAILURE;
+  }
+
+  exe::runtime::Reactor reactor;
+  reactor.Init(64);
+  exe::runtime::ManualLoop loop;
+
+  exe::fiber::io::TransferResult sent;
+  exe::fiber::io::TransferResult spliced;
+  ::std::vector<char> received;
+
+  // file -> first
+  exe::fiber::Go(loop, [&] noexcept {
+    // Asks for more than the file holds, stops at its end
+    sent = exe::fiber::io::SendFile(reactor, first[0], file, 0, 2 * kSize);
+    ::close(first[0]);
+  });
+
+  // first -> second
+  exe::fiber::Go(loop, [&] noexcept {
+    spliced = exe::fiber::io::Splice(reactor, first[1], second[0], 2 * kSize);
+    ::close(second[0]);
+  });
+
+  // second -> received
+  exe::fiber::Go(loop, [&] noexcept {
+    char buf[1 << 16];
+    while (true) {
+      auto const cnt = ::read(second[1], buf, sizeof(buf));
+      if (cnt > 0) {
+        received.insert(received.end(), buf, buf + cnt);
+      } else if (cnt == 0 || exe::fiber::io::WaitReadable(reactor, second[1])) {
+        break;
+      }
+    }
+    reactor.Stop();
+  });
+
+  reactor.Run(loop);
+  reactor.Close();
+
+  ::close(first[1]);
+  ::close(second[1]);
+  ::close(file);
+
+  ::std::cout << ::std::format("sent: {}, spliced: {}, received: {}\n",
+                               sent.bytes, spliced.bytes, received.size());
+
+  auto const ok = !sent.error && sent.bytes == kSize &&
+                  !spliced.error && spliced.bytes == kSize &&
+                  received == data;
+  return ok ? EXIT_SUCCESS : EXIT_FAILURE;
+}
+
+int TestSplicePipeReuse() {
+  exe::fiber::io::SplicePipe pipe;
+  if (pipe.IsOpen() || pipe.Open() || !pipe.IsOpen()) {
+    return EXIT_FAILURE;
+  }
+
+  pipe.Close();
+  return pipe.IsOpen() ? EXIT_FAILURE : EXIT_SUCCESS;
+}
+
+int main() {
+  for (auto test : {TestSendFileSplice, TestSplicePipeReuse}) {
+    if (auto const res = test(); res != EXIT_SUCCESS) {
+      return res;
+    }
+  }
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,99 @@
+//
+// t_yield.cpp
+// ~~~~~~~~~~~
+//
+// Copyright (C) 2026 Artyom Kolpakov <ddvamp007@gmail.com>
+//
+// Licensed under GNU GPL-3.0-or-later.
+// See file LICENSE or <https://www.gnu.org/licenses/> for details.
+//
+
+#include <exe/fiber/api.hpp>
+#include <exe/runtime/manual_loop.hpp>
+#include <exe/runtime/thread_pool.hpp>
+#include <exe/runtime/safe_scheduler.hpp>
+
+#include <concurrency/wait_group.hpp>
+
+#include <atomic>
+#include <cstdlib>
+#include <string>
+
+int TestYieldSharedQueue() {
+  exe::runtime::ThreadPool pool(1);
+  exe::runtime::SafeScheduler sched(pool);
+  concurrency::WaitGroup wg;
+  ::std::string order;
+
+  pool.Start();
+  wg.Reset(2);
+
+  // The yielding fiber is queued behind the one spawned before
+  exe::fiber::Go(sched, [&] noexcept {
+    exe::fiber::Go([&] noexcept {
+      order += 'S';
+      wg.Done();
+    });
+    exe::fiber::self::Yield();
+    order += 'Y';
+    wg.Done();
+  });
+
+  wg.Wait();
+  pool.Stop();
+  return order == "SY" ? EXIT_SUCCESS : EXIT_FAILURE;
+}
+
+int TestYieldLocalProgress() {
+  exe::runtime::ThreadPool pool(1);
+  exe::runtime::SafeScheduler sched(pool);
+  concurrency::WaitGroup wg;
+  ::std::atomic_bool flag = false;
+
+  pool.Start();
+  wg.Reset(2);
+
+  // Fibers of the shared queue still run while the local one spins
+  exe::fiber::Go(sched, [&] noexcept {
+    exe::fiber::Go([&] noexcept {
+      flag.store(true, ::std::memory_order_relaxed);
+      wg.Done();
+    });
+    while (!flag.load(::std::memory_order_relaxed)) {
+      exe::fiber::self::YieldLocal();
+    }
+    wg.Done();
+  });
+
+  wg.Wait();
+  pool.Stop();
+  return EXIT_SUCCESS;
+}
+
+int TestYieldLocalElsewhere() {
+  exe::runtime::ManualLoop loop;
+  ::std::string order;
+
+  // Without a thread pool, the call is equivalent to yield
+  for (auto const name : {'A', 'B'}) {
+    exe::fiber::Go(loop, [&order, name] noexcept {
+      for (auto cnt = 0; cnt != 3; ++cnt) {
+        order += name;
+        exe::fiber::self::YieldLocal();
+      }
+    });
+  }
+
+  loop.Run();
+  return order == "ABABAB" ? EXIT_SUCCESS : EXIT_FAILURE;
+}
+
+int main() {
+  for (auto test : {TestYieldSharedQueue, TestYieldLocalProgress,
+                    TestYieldLocalElsewhere}) {
+    if (auto const res = test(); res != EXIT_SUCCESS) {
+      return res;
+    }
+  }
+  return EXIT_SUCCESS;
+}